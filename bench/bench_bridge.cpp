@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include "mreq/mreq.hpp"
+#include "mreq/platform/posix/bridge.hpp"
+
+// Köprü throughput'u: loopback üzerinden publish -> encode -> sendmmsg -> recvmmsg -> decode -> publish.
+// Tek thread her iki ucu da sürer; items_per_second, bir çekirdekte uçtan uca mesaj/saniyedir.
+
+struct BridgeSample {
+    uint64_t timestamp;
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    float temperature;
+};
+
+#define BridgeSample_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT64,   timestamp,         1) \
+X(a, STATIC,   SINGULAR, INT32,    x,                 2) \
+X(a, STATIC,   SINGULAR, INT32,    y,                 3) \
+X(a, STATIC,   SINGULAR, INT32,    z,                 4) \
+X(a, STATIC,   SINGULAR, FLOAT,    temperature,       5)
+#define BridgeSample_CALLBACK NULL
+#define BridgeSample_DEFAULT NULL
+
+extern const pb_msgdesc_t BridgeSample_msg;
+#define BridgeSample_fields &BridgeSample_msg
+PB_BIND(BridgeSample, BridgeSample, AUTO)
+#define BridgeSample_size 49
+MREQ_RAW_LAYOUT(BridgeSample)
+MREQ_MAX_ENCODED_SIZE(BridgeSample)
+
+MREQ_METADATA_DECLARE(bench_bridge_tx);
+MREQ_METADATA_DECLARE(bench_bridge_rx);
+
+REGISTER_TOPIC_WITH_BUFFER(BridgeSample, bench_bridge_tx, 256);
+MREQ_NANOPB_METADATA_DEFINE(BridgeSample, bench_bridge_tx, 256);
+REGISTER_TOPIC_WITH_BUFFER(BridgeSample, bench_bridge_rx, 256);
+MREQ_NANOPB_METADATA_DEFINE(BridgeSample, bench_bridge_rx, 256);
+
+// Arg 1: gönderim kodlaması (0: nanopb, 1: ham memcpy)
+static mreq::log::Encoding encoding_arg(const benchmark::State& state) {
+    return state.range(1) ? mreq::log::Encoding::Raw : mreq::log::Encoding::Nanopb;
+}
+
+static void BM_Bridge_UdpLoopback(benchmark::State& state) {
+    const size_t burst = static_cast<size_t>(state.range(0));
+    const mreq::mreq_metadata* tx = MREQ_GET_METADATA(bench_bridge_tx);
+    const mreq::mreq_metadata* rx = MREQ_GET_METADATA(bench_bridge_rx);
+
+    mreq::SocketBridge receiver;
+    mreq::SocketBridge sender;
+    if (!receiver.open_udp("127.0.0.1", 0) ||
+        !sender.open_udp("127.0.0.1", 0, "127.0.0.1", receiver.local_port())) {
+        state.SkipWithError("UDP loopback açılamadı");
+        return;
+    }
+    sender.set_encoding(encoding_arg(state));
+    sender.add(tx);
+    receiver.route(tx->message_id, rx);
+    Token token = rx->subscribe().value();
+
+    BridgeSample sample{1700000000000ull, 120, -45, 981, 36.6f};
+    BridgeSample out[256];
+    uint64_t received = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < burst; ++i) {
+            sample.timestamp++;
+            tx->publish(&sample);
+        }
+        sender.send();
+        received += receiver.receive();
+        while (rx->read_multiple(token, out, 256) > 0) {}
+    }
+    rx->unsubscribe(token);
+
+    state.SetItemsProcessed(static_cast<int64_t>(received));
+    state.counters["loss"] = benchmark::Counter(
+        1.0 - static_cast<double>(received) / static_cast<double>(state.iterations() * burst));
+    state.counters["frames_per_datagram"] = benchmark::Counter(
+        static_cast<double>(sender.frames_sent()) / static_cast<double>(sender.datagrams_sent()));
+}
+
+BENCHMARK(BM_Bridge_UdpLoopback)->ArgsProduct({{1, 32, 128}, {0, 1}});
+
+// Sadece çerçeve kodlama + çözme maliyeti (soket yok): kayıt/köprü hattının CPU payı
+static void BM_Frame_EncodeDecode(benchmark::State& state) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(bench_bridge_tx);
+    const mreq::log::Encoding encoding = encoding_arg(state);
+    alignas(8) uint8_t buffer[128];
+    BridgeSample sample{1700000000000ull, 120, -45, 981, 36.6f};
+    BridgeSample out{};
+    for (auto _ : state) {
+        sample.timestamp++;
+        const size_t written = mreq::log::encode_frame(*meta, &sample, 1, 0, buffer, sizeof(buffer), encoding);
+        size_t offset = 0;
+        mreq::log::Frame frame{};
+        mreq::log::next_frame(buffer, written, offset, frame);
+        benchmark::DoNotOptimize(mreq::log::decode_frame(*meta, frame, &out));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_Frame_EncodeDecode)->Args({0, 0})->Args({0, 1});
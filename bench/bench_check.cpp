@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include "bench_messages.hpp"
+
+REGISTER_TOPIC_WITH_BUFFER(BenchSample, bench_sample, 8);
+MREQ_NANOPB_METADATA_DEFINE(BenchSample, bench_sample, 8);
+
+// Boşta polling: yeni mesaj yokken check() maliyeti (kontrol döngülerinin en sık yolu)
+static void BM_Topic_CheckIdle(benchmark::State& state) {
+    mreq::Topic<BenchSample, 8> topic;
+    Token token = topic.subscribe().value();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(topic.check(token));
+    }
+    topic.unsubscribe(token);
+}
+BENCHMARK(BM_Topic_CheckIdle);
+
+static void BM_SeqlockTopic_CheckIdle(benchmark::State& state) {
+    mreq::SeqlockTopic<BenchSample, 8> topic;
+    Token token = topic.subscribe().value();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(topic.check(token));
+    }
+    topic.unsubscribe(token);
+}
+BENCHMARK(BM_SeqlockTopic_CheckIdle);
+
+// Metadata function-pointer yolu üzerinden
+static void BM_Metadata_CheckIdle(benchmark::State& state) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(bench_sample);
+    Token token = meta->subscribe().value();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meta->check(token));
+    }
+    meta->unsubscribe(token);
+}
+BENCHMARK(BM_Metadata_CheckIdle);
+
+// Referans: eski check() yolunun maliyeti (iki lock/unlock çifti)
+static void BM_Reference_TwoLockPairs(benchmark::State& state) {
+    mreq::Mutex topic_mtx;
+    mreq::Mutex table_mtx;
+    for (auto _ : state) {
+        topic_mtx.lock();
+        table_mtx.lock();
+        table_mtx.unlock();
+        topic_mtx.unlock();
+    }
+}
+BENCHMARK(BM_Reference_TwoLockPairs);
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include "bench_messages.hpp"
+
+// Çekişme ölçeklenmesi: 1-16 thread, aynı topic üzerinde.
+// Topic nesneleri thread'ler arasında paylaşılır; thread 0 ölçüm başlamadan önce oluşturur.
+
+namespace {
+
+using Msg = BenchPayload<64>;
+
+template<typename TopicT>
+struct SharedTopic {
+    static TopicT& get() {
+        static TopicT topic;
+        return topic;
+    }
+};
+
+} // namespace
+
+// Tüm thread'ler aynı topic'e yazar
+template<typename TopicT>
+static void BM_Contention_Writers(benchmark::State& state) {
+    TopicT& topic = SharedTopic<TopicT>::get();
+    Msg msg{};
+    msg.seq = static_cast<uint64_t>(state.thread_index()) << 32;
+    for (auto _ : state) {
+        msg.seq++;
+        topic.publish(msg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Thread 0 yazar, diğer thread'ler check() + read() ile okur
+template<typename TopicT>
+static void BM_Contention_Readers(benchmark::State& state) {
+    TopicT& topic = SharedTopic<TopicT>::get();
+    if (state.thread_index() == 0) {
+        Msg msg{};
+        for (auto _ : state) {
+            msg.seq++;
+            topic.publish(msg);
+        }
+        state.SetItemsProcessed(state.iterations());
+        return;
+    }
+
+    Token token = topic.subscribe().value();
+    int64_t received = 0;
+    for (auto _ : state) {
+        if (topic.check(token)) {
+            received += topic.read(token).has_value();
+        }
+    }
+    topic.unsubscribe(token);
+    state.counters["received"] = benchmark::Counter(static_cast<double>(received), benchmark::Counter::kIsRate);
+}
+
+// Okuyucular yazar olmadan boşta check() yapar (paylaşılan cache hattı maliyeti)
+template<typename TopicT>
+static void BM_Contention_IdleCheck(benchmark::State& state) {
+    TopicT& topic = SharedTopic<TopicT>::get();
+    Token token = topic.subscribe().value();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(topic.check(token));
+    }
+    topic.unsubscribe(token);
+}
+
+BENCHMARK_TEMPLATE(BM_Contention_Writers, mreq::Topic<Msg, 64>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contention_Writers, mreq::MultiProducerTopic<Msg, 64>)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_Contention_Readers, mreq::Topic<Msg, 64>)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contention_Readers, mreq::SeqlockTopic<Msg, 64>)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contention_Readers, mreq::MultiProducerTopic<Msg, 64>)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contention_Readers, mreq::LatestTopic<Msg>)->ThreadRange(2, 16)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_Contention_IdleCheck, mreq::Topic<Msg, 64>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contention_IdleCheck, mreq::SeqlockTopic<Msg, 64>)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,110 @@
+#ifdef MREQ_ENABLE_COROUTINES
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "bench_messages.hpp"
+#include "mreq/clock.hpp"
+#include "mreq/coroutine.hpp"
+
+// Coroutine katmanı: tek executor thread'ini paylaşan N tüketiciye dağıtım maliyeti ve
+// publish'ten tüketicinin devam etmesine kadar geçen uyanma gecikmesi.
+
+namespace {
+
+using FanTopic = mreq::Topic<BenchSample, 8, 512>;
+
+mreq::Task consume(FanTopic* topic, Token token, int64_t* received) {
+    for (;;) {
+        auto msg = co_await topic->next(token);
+        if (!msg) co_return;
+        ++*received;
+    }
+}
+
+struct LatencyProbe {
+    std::atomic<uint64_t> latency_ns{0};
+    std::atomic<bool> done{false};
+};
+
+mreq::Task measure(FanTopic* topic, Token token, LatencyProbe* probe) {
+    for (;;) {
+        auto msg = co_await topic->next(token);
+        if (!msg) co_return;
+        probe->latency_ns.store(mreq::now_ns() - msg->timestamp, std::memory_order_relaxed);
+        probe->done.store(true, std::memory_order_release);
+    }
+}
+
+} // namespace
+
+// Bir mesajın N askıdaki tüketiciye dağıtımı (publish + poll, tek thread)
+static void BM_Coroutine_FanOut(benchmark::State& state) {
+    const size_t consumers = static_cast<size_t>(state.range(0));
+    auto topic = std::make_unique<FanTopic>();
+    int64_t received = 0;
+    mreq::Executor executor;
+    for (size_t i = 0; i < consumers; ++i) {
+        executor.spawn(consume(topic.get(), topic->subscribe().value(), &received));
+    }
+    executor.poll();
+
+    BenchSample sample{};
+    for (auto _ : state) {
+        sample.timestamp++;
+        topic->publish(sample);
+        executor.poll();
+    }
+    state.SetItemsProcessed(received);
+}
+BENCHMARK(BM_Coroutine_FanOut)->Arg(1)->Arg(64)->Arg(256);
+
+// Karşılaştırma: aynı N abonenin her mesajda check() + read() ile yoklanması
+static void BM_Polling_FanOut(benchmark::State& state) {
+    const size_t consumers = static_cast<size_t>(state.range(0));
+    auto topic = std::make_unique<FanTopic>();
+    std::vector<Token> tokens;
+    for (size_t i = 0; i < consumers; ++i) {
+        tokens.push_back(topic->subscribe().value());
+    }
+
+    int64_t received = 0;
+    BenchSample sample{};
+    for (auto _ : state) {
+        sample.timestamp++;
+        topic->publish(sample);
+        for (Token token : tokens) {
+            if (topic->check(token)) received += topic->read(token).has_value();
+        }
+    }
+    state.SetItemsProcessed(received);
+}
+BENCHMARK(BM_Polling_FanOut)->Arg(1)->Arg(64)->Arg(256);
+
+// Başka thread'den publish ile uyuyan executor'daki tüketicinin devam etmesi arasındaki süre
+static void BM_Coroutine_WakeupLatency(benchmark::State& state) {
+    auto topic = std::make_unique<FanTopic>();
+    LatencyProbe probe;
+    mreq::Executor executor;
+    executor.spawn(measure(topic.get(), topic->subscribe().value(), &probe));
+    std::thread runner([&executor] { executor.run(); });
+
+    BenchSample sample{};
+    for (auto _ : state) {
+        probe.done.store(false, std::memory_order_relaxed);
+        // Executor'ın uykuya dalmasına izin ver
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        sample.timestamp = mreq::now_ns();
+        topic->publish(sample);
+        while (!probe.done.load(std::memory_order_acquire)) std::this_thread::yield();
+        state.SetIterationTime(static_cast<double>(probe.latency_ns.load(std::memory_order_relaxed)) * 1e-9);
+    }
+
+    executor.stop();
+    runner.join();
+}
+BENCHMARK(BM_Coroutine_WakeupLatency)->UseManualTime();
+
+#endif // MREQ_ENABLE_COROUTINES
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include "mreq/mreq.hpp"
+#include "mreq/topic_registry.hpp"
+
+// Benchmark mesaj yapıları (global namespace'de)
+struct BenchSample {
+    uint64_t timestamp;
+    float x;
+    float y;
+    float z;
+    uint32_t device_id;
+};
+
+// Boyut taramaları için sabit boyutlu yük (16 B - 64 KB)
+template<size_t Bytes>
+struct BenchPayload {
+    static_assert(Bytes >= 16, "En küçük yük 16 byte");
+    uint64_t seq;
+    uint8_t data[Bytes - sizeof(uint64_t)];
+};
+
+// nanopb tanımlayıcısı olmayan mesajlar için (encode/decode kullanılmaz)
+constexpr const pb_msgdesc_t* BenchSample_fields = nullptr;
+
+MREQ_METADATA_DECLARE(bench_sample);
+MREQ_TOPIC_DECLARE(BenchSample, bench_sample, 8);
@@ -0,0 +1,140 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "bench_messages.hpp"
+#include "mreq/clock.hpp"
+
+// POSIX kilit politikalarının karşılaştırması: PthreadMutex (varsayılan öznitelikler),
+// AdaptiveMutex (sınırlı dönme + futex) ve PriorityInheritMutex (PTHREAD_PRIO_INHERIT).
+
+namespace {
+
+using Msg = BenchPayload<64>;
+
+template<typename MutexT>
+using MutexTopic = mreq::Topic<Msg, 64, MREQ_MAX_SUBSCRIBERS, MutexT>;
+
+template<typename T>
+struct Shared {
+    static T& get() {
+        static T value;
+        return value;
+    }
+};
+
+void busy_wait_ns(uint64_t ns) {
+    const uint64_t end = mreq::monotonic_ns() + ns;
+    while (mreq::monotonic_ns() < end) {
+        mreq::internal::cpu_relax();
+    }
+}
+
+} // namespace
+
+// Çekişmesiz lock() + unlock(): her topic işleminin kilide ödediği sabit maliyet.
+// glibc tek thread'li süreçte pthread kilidindeki atomik işlemleri atladığından ölçüm
+// boyunca boşta bekleyen ikinci bir thread tutulur (gerçek uygulamalar çok thread'lidir).
+template<typename MutexT>
+static void BM_Mutex_LockUnlock(benchmark::State& state) {
+    std::atomic<bool> done{false};
+    std::thread idle([&] {
+        while (!done.load(std::memory_order_relaxed)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    MutexT mtx;
+    for (auto _ : state) {
+        mtx.lock();
+        benchmark::ClobberMemory();
+        mtx.unlock();
+    }
+    done.store(true, std::memory_order_relaxed);
+    idle.join();
+}
+
+// Topic'teki kadar kısa kritik bölge (64 B kopya) ile çekişme; zaman, kilidin tutulduğu
+// ve el değiştirdiği toplam süredir
+template<typename MutexT>
+static void BM_Mutex_ShortCriticalSection(benchmark::State& state) {
+    MutexT& mtx = Shared<MutexT>::get();
+    static Msg slot;
+    Msg msg{};
+    for (auto _ : state) {
+        msg.seq++;
+        mtx.lock();
+        slot = msg;
+        benchmark::ClobberMemory();
+        mtx.unlock();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Aynı topic'e çok yazıcı: politika başına publish() ölçeklenmesi
+template<typename MutexT>
+static void BM_Mutex_TopicWriters(benchmark::State& state) {
+    MutexTopic<MutexT>& topic = Shared<MutexTopic<MutexT>>::get();
+    Msg msg{};
+    msg.seq = static_cast<uint64_t>(state.thread_index()) << 32;
+    for (auto _ : state) {
+        msg.seq++;
+        topic.publish(msg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Uyanma gecikmesi: kilidi bekleyen thread'in, tutucu unlock() ettikten sonra kilidi alana
+// kadar geçen süre. Tutucu kilidi range(0) µs tutar; kısa tutmada AdaptiveMutex bekleyeni
+// dönerken yakalar, uzun tutmada bekleyen futex'te uyur ve uyandırılması ölçülür.
+template<typename MutexT>
+static void BM_Mutex_WakeupLatency(benchmark::State& state) {
+    enum Phase : int { kIdle, kGo, kAcquired, kStop };
+    MutexT mtx;
+    std::atomic<int> phase{kIdle};
+    std::atomic<uint64_t> acquired_ns{0};
+    const uint64_t hold_ns = static_cast<uint64_t>(state.range(0)) * 1000;
+
+    std::thread waiter([&] {
+        for (;;) {
+            int p;
+            while ((p = phase.load(std::memory_order_acquire)) == kIdle) std::this_thread::yield();
+            if (p == kStop) return;
+            mtx.lock();
+            acquired_ns.store(mreq::monotonic_ns(), std::memory_order_relaxed);
+            mtx.unlock();
+            phase.store(kAcquired, std::memory_order_release);
+            while (phase.load(std::memory_order_acquire) == kAcquired) std::this_thread::yield();
+        }
+    });
+
+    for (auto _ : state) {
+        mtx.lock();
+        phase.store(kGo, std::memory_order_release);
+        busy_wait_ns(hold_ns);
+        const uint64_t released_ns = mreq::monotonic_ns();
+        mtx.unlock();
+        while (phase.load(std::memory_order_acquire) != kAcquired) std::this_thread::yield();
+        const uint64_t latency = acquired_ns.load(std::memory_order_relaxed) - released_ns;
+        state.SetIterationTime(static_cast<double>(latency) * 1e-9);
+        phase.store(kIdle, std::memory_order_release);
+    }
+
+    phase.store(kStop, std::memory_order_release);
+    waiter.join();
+}
+
+BENCHMARK_TEMPLATE(BM_Mutex_LockUnlock, mreq::PthreadMutex);
+BENCHMARK_TEMPLATE(BM_Mutex_LockUnlock, mreq::AdaptiveMutex);
+BENCHMARK_TEMPLATE(BM_Mutex_LockUnlock, mreq::PriorityInheritMutex);
+
+BENCHMARK_TEMPLATE(BM_Mutex_ShortCriticalSection, mreq::PthreadMutex)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Mutex_ShortCriticalSection, mreq::AdaptiveMutex)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Mutex_ShortCriticalSection, mreq::PriorityInheritMutex)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_Mutex_TopicWriters, mreq::PthreadMutex)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Mutex_TopicWriters, mreq::AdaptiveMutex)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Mutex_TopicWriters, mreq::PriorityInheritMutex)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_Mutex_WakeupLatency, mreq::PthreadMutex)->Arg(2)->Arg(100)->UseManualTime();
+BENCHMARK_TEMPLATE(BM_Mutex_WakeupLatency, mreq::AdaptiveMutex)->Arg(2)->Arg(100)->UseManualTime();
+BENCHMARK_TEMPLATE(BM_Mutex_WakeupLatency, mreq::PriorityInheritMutex)->Arg(2)->Arg(100)->UseManualTime();
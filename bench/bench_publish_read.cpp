@@ -0,0 +1,344 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "bench_messages.hpp"
+
+// Tek thread'li sıcak yollar: publish gecikmesi, read gecikmesi, read_multiple throughput.
+// Her ölçüm doğrudan topic API'si ve mreq_metadata fonksiyon-pointer yolu için yapılır.
+
+namespace {
+
+// Herhangi bir topic'i metadata fonksiyon tablosuna bağlar (registry'deki type-erased yol)
+template<typename TopicT>
+mreq::mreq_metadata make_metadata(TopicT& topic) {
+    return {
+        "bench",
+        sizeof(typename TopicT::value_type),
+        0,
+        nullptr,
+        &topic,
+        TopicT::static_subscribe,
+        TopicT::static_unsubscribe,
+        TopicT::static_check,
+        TopicT::static_publish,
+        TopicT::static_read,
+        TopicT::static_read_multiple,
+        TopicT::static_attach_listener,
+        TopicT::static_detach_listener,
+        TopicT::static_stats,
+        TopicT::static_read_info,
+        TopicT::static_read_multiple_info,
+        TopicT::static_publish_multiple,
+        0,
+        0
+    };
+}
+
+template<typename TopicT>
+void set_bytes(benchmark::State& state, size_t messages_per_iteration) {
+    const int64_t messages = static_cast<int64_t>(state.iterations() * messages_per_iteration);
+    state.SetItemsProcessed(messages);
+    state.SetBytesProcessed(messages * static_cast<int64_t>(sizeof(typename TopicT::value_type)));
+}
+
+} // namespace
+
+template<typename TopicT>
+static void BM_Publish(benchmark::State& state) {
+    auto topic = std::make_unique<TopicT>();
+    typename TopicT::value_type msg{};
+    for (auto _ : state) {
+        msg.seq++;
+        topic->publish(msg);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<TopicT>(state, 1);
+}
+
+template<typename TopicT>
+static void BM_Metadata_Publish(benchmark::State& state) {
+    auto topic = std::make_unique<TopicT>();
+    const mreq::mreq_metadata meta = make_metadata(*topic);
+    typename TopicT::value_type msg{};
+    for (auto _ : state) {
+        msg.seq++;
+        meta.publish(&msg);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<TopicT>(state, 1);
+}
+
+// Bir publish + bir read: okuyucunun her zaman hazır bir mesajı vardır
+template<typename TopicT>
+static void BM_PublishRead(benchmark::State& state) {
+    auto topic = std::make_unique<TopicT>();
+    Token token = topic->subscribe().value();
+    typename TopicT::value_type msg{};
+    for (auto _ : state) {
+        msg.seq++;
+        topic->publish(msg);
+        benchmark::DoNotOptimize(topic->read(token));
+    }
+    topic->unsubscribe(token);
+    set_bytes<TopicT>(state, 1);
+}
+
+template<typename TopicT>
+static void BM_Metadata_PublishRead(benchmark::State& state) {
+    auto topic = std::make_unique<TopicT>();
+    const mreq::mreq_metadata meta = make_metadata(*topic);
+    Token token = meta.subscribe().value();
+    typename TopicT::value_type msg{};
+    for (auto _ : state) {
+        msg.seq++;
+        meta.publish(&msg);
+        benchmark::DoNotOptimize(meta.read<typename TopicT::value_type>(token));
+    }
+    meta.unsubscribe(token);
+    set_bytes<TopicT>(state, 1);
+}
+
+// Ring doldurulur, ardından tek read_multiple çağrısıyla boşaltılır
+template<typename TopicT, size_t N>
+static void BM_ReadMultiple(benchmark::State& state) {
+    using Msg = typename TopicT::value_type;
+    auto topic = std::make_unique<TopicT>();
+    auto out = std::make_unique<Msg[]>(N);
+    Token token = topic->subscribe().value();
+    Msg msg{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < N; ++i) {
+            msg.seq++;
+            topic->publish(msg);
+        }
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(topic->read_multiple(token, out.get(), N));
+    }
+    topic->unsubscribe(token);
+    set_bytes<TopicT>(state, N);
+}
+
+template<typename TopicT, size_t N>
+static void BM_Metadata_ReadMultiple(benchmark::State& state) {
+    using Msg = typename TopicT::value_type;
+    auto topic = std::make_unique<TopicT>();
+    const mreq::mreq_metadata meta = make_metadata(*topic);
+    auto out = std::make_unique<Msg[]>(N);
+    Token token = meta.subscribe().value();
+    Msg msg{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < N; ++i) {
+            msg.seq++;
+            meta.publish(&msg);
+        }
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(meta.read_multiple(token, out.get(), N));
+    }
+    meta.unsubscribe(token);
+    set_bytes<TopicT>(state, N);
+}
+
+// read_multiple ile aynı doldurma; mesajlar kopyalanmadan span'ler üzerinde işlenir
+template<typename TopicT, size_t N>
+static void BM_ReadSpans(benchmark::State& state) {
+    using Msg = typename TopicT::value_type;
+    auto topic = std::make_unique<TopicT>();
+    Token token = topic->subscribe().value();
+    Msg msg{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < N; ++i) {
+            msg.seq++;
+            topic->publish(msg);
+        }
+        state.ResumeTiming();
+        auto spans = topic->read_spans(token);
+        uint64_t sum = 0;
+        for (const Msg& m : spans.first()) sum += m.seq;
+        for (const Msg& m : spans.second()) sum += m.seq;
+        benchmark::DoNotOptimize(sum);
+    }
+    topic->unsubscribe(token);
+    set_bytes<TopicT>(state, N);
+}
+
+// Mesaj boyutu taraması (N = 8), her topic politikası için
+#define MREQ_BENCH_SIZES(BM, TOPIC) \
+    BENCHMARK_TEMPLATE(BM, TOPIC<BenchPayload<16>, 8>); \
+    BENCHMARK_TEMPLATE(BM, TOPIC<BenchPayload<256>, 8>); \
+    BENCHMARK_TEMPLATE(BM, TOPIC<BenchPayload<4096>, 8>); \
+    BENCHMARK_TEMPLATE(BM, TOPIC<BenchPayload<65536>, 8>)
+
+MREQ_BENCH_SIZES(BM_Publish, mreq::Topic);
+MREQ_BENCH_SIZES(BM_Publish, mreq::SeqlockTopic);
+MREQ_BENCH_SIZES(BM_Publish, mreq::MultiProducerTopic);
+MREQ_BENCH_SIZES(BM_Metadata_Publish, mreq::Topic);
+
+MREQ_BENCH_SIZES(BM_PublishRead, mreq::Topic);
+MREQ_BENCH_SIZES(BM_PublishRead, mreq::SeqlockTopic);
+MREQ_BENCH_SIZES(BM_PublishRead, mreq::MultiProducerTopic);
+MREQ_BENCH_SIZES(BM_Metadata_PublishRead, mreq::Topic);
+
+// Durum topic'leri: sadece en güncel değer (64 B mesaj)
+BENCHMARK_TEMPLATE(BM_Publish, mreq::Topic<BenchPayload<64>, 1>);
+BENCHMARK_TEMPLATE(BM_Publish, mreq::SeqlockTopic<BenchPayload<64>, 1>);
+BENCHMARK_TEMPLATE(BM_Publish, mreq::LatestTopic<BenchPayload<64>>);
+BENCHMARK_TEMPLATE(BM_PublishRead, mreq::SeqlockTopic<BenchPayload<64>, 1>);
+BENCHMARK_TEMPLATE(BM_PublishRead, mreq::LatestTopic<BenchPayload<64>>);
+BENCHMARK_TEMPLATE(BM_Metadata_PublishRead, mreq::LatestTopic<BenchPayload<64>>);
+
+// Ring boyutu taraması (64 B mesaj)
+BENCHMARK_TEMPLATE(BM_PublishRead, mreq::Topic<BenchPayload<64>, 1>);
+BENCHMARK_TEMPLATE(BM_PublishRead, mreq::Topic<BenchPayload<64>, 64>);
+BENCHMARK_TEMPLATE(BM_PublishRead, mreq::Topic<BenchPayload<64>, 1024>);
+
+BENCHMARK_TEMPLATE(BM_ReadMultiple, mreq::Topic<BenchPayload<64>, 8>, 8);
+BENCHMARK_TEMPLATE(BM_ReadMultiple, mreq::Topic<BenchPayload<64>, 64>, 64);
+BENCHMARK_TEMPLATE(BM_ReadMultiple, mreq::Topic<BenchPayload<64>, 1024>, 1024);
+BENCHMARK_TEMPLATE(BM_ReadMultiple, mreq::Topic<BenchPayload<4096>, 64>, 64);
+BENCHMARK_TEMPLATE(BM_ReadMultiple, mreq::SeqlockTopic<BenchPayload<64>, 64>, 64);
+BENCHMARK_TEMPLATE(BM_ReadMultiple, mreq::MultiProducerTopic<BenchPayload<64>, 64>, 64);
+BENCHMARK_TEMPLATE(BM_Metadata_ReadMultiple, mreq::Topic<BenchPayload<64>, 64>, 64);
+BENCHMARK_TEMPLATE(BM_ReadSpans, mreq::Topic<BenchPayload<64>, 64>, 64);
+BENCHMARK_TEMPLATE(BM_ReadSpans, mreq::Topic<BenchPayload<64>, 1024>, 1024);
+BENCHMARK_TEMPLATE(BM_ReadSpans, mreq::Topic<BenchPayload<4096>, 64>, 64);
+
+// Sürücü FIFO'su gibi burst yayınlama: tek tek publish ile publish_multiple karşılaştırması
+template<typename TopicT, size_t Burst>
+static void BM_PublishBurst_Loop(benchmark::State& state) {
+    using Msg = typename TopicT::value_type;
+    auto topic = std::make_unique<TopicT>();
+    Msg batch[Burst] = {};
+    for (auto _ : state) {
+        for (size_t i = 0; i < Burst; ++i) {
+            topic->publish(batch[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    set_bytes<TopicT>(state, Burst);
+}
+
+template<typename TopicT, size_t Burst>
+static void BM_PublishBurst_Multiple(benchmark::State& state) {
+    using Msg = typename TopicT::value_type;
+    auto topic = std::make_unique<TopicT>();
+    Msg batch[Burst] = {};
+    for (auto _ : state) {
+        topic->publish_multiple(batch, Burst);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<TopicT>(state, Burst);
+}
+
+BENCHMARK_TEMPLATE(BM_PublishBurst_Loop, mreq::Topic<BenchPayload<16>, 100>, 32);
+BENCHMARK_TEMPLATE(BM_PublishBurst_Multiple, mreq::Topic<BenchPayload<16>, 100>, 32);
+BENCHMARK_TEMPLATE(BM_PublishBurst_Loop, mreq::Topic<BenchPayload<16>, 100>, 64);
+BENCHMARK_TEMPLATE(BM_PublishBurst_Multiple, mreq::Topic<BenchPayload<16>, 100>, 64);
+BENCHMARK_TEMPLATE(BM_PublishBurst_Loop, mreq::SeqlockTopic<BenchPayload<16>, 100>, 64);
+BENCHMARK_TEMPLATE(BM_PublishBurst_Multiple, mreq::SeqlockTopic<BenchPayload<16>, 100>, 64);
+BENCHMARK_TEMPLATE(BM_PublishBurst_Loop, mreq::MultiProducerTopic<BenchPayload<16>, 100>, 64);
+BENCHMARK_TEMPLATE(BM_PublishBurst_Multiple, mreq::MultiProducerTopic<BenchPayload<16>, 100>, 64);
+
+// Yüksek frekanslı topic'e düşük frekanslı tüketici: her publish sonrası yoklayan abone
+// 100 mesajdan birini ister. Discard: hepsini okuyup 99'unu atar; Decimated: every(100)
+// aboneliğiyle atlanan mesajlar kopyalanmaz ve kilitlenmez.
+template<typename TopicT>
+static void BM_LowRate_Discard(benchmark::State& state) {
+    using Msg = typename TopicT::value_type;
+    auto topic = std::make_unique<TopicT>();
+    Token token = topic->subscribe().value();
+    Msg msg{};
+    size_t kept = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < 100; ++i) {
+            msg.seq++;
+            topic->publish(msg);
+            if (topic->check(token)) {
+                auto read = topic->read(token);
+                if (read && read->seq % 100 == 0) ++kept;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(kept);
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+
+template<typename TopicT>
+static void BM_LowRate_Decimated(benchmark::State& state) {
+    using Msg = typename TopicT::value_type;
+    auto topic = std::make_unique<TopicT>();
+    Token token = topic->subscribe(mreq::SubscribeOptions::every(100)).value();
+    Msg msg{};
+    size_t kept = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < 100; ++i) {
+            msg.seq++;
+            topic->publish(msg);
+            if (topic->check(token)) {
+                kept += topic->read(token).has_value();
+            }
+        }
+    }
+    benchmark::DoNotOptimize(kept);
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK_TEMPLATE(BM_LowRate_Discard, mreq::Topic<BenchPayload<64>, 8>);
+BENCHMARK_TEMPLATE(BM_LowRate_Decimated, mreq::Topic<BenchPayload<64>, 8>);
+BENCHMARK_TEMPLATE(BM_LowRate_Discard, mreq::Topic<BenchPayload<4096>, 8>);
+BENCHMARK_TEMPLATE(BM_LowRate_Decimated, mreq::Topic<BenchPayload<4096>, 8>);
+
+// Fan-in topic: 16 cihazın örnekleri tek topic'te, tüketici sadece bir cihazı ister.
+// Discard: her mesajı kopyalayıp device_id'ye bakar; Filtered: field_equals filtresi
+// ring'de yerinde değerlendirilir, sadece eşleşen mesaj kopyalanır.
+template<size_t Bytes>
+struct FanInSample {
+    uint32_t device_id;
+    uint8_t data[Bytes - sizeof(uint32_t)];
+};
+
+template<size_t Bytes>
+static void BM_FanIn_Discard(benchmark::State& state) {
+    using Msg = FanInSample<Bytes>;
+    auto topic = std::make_unique<mreq::Topic<Msg, 16>>();
+    auto out = std::make_unique<Msg[]>(16);
+    Token token = topic->subscribe().value();
+    Msg sample{};
+    size_t kept = 0;
+    for (auto _ : state) {
+        for (uint32_t device = 0; device < 16; ++device) {
+            sample.device_id = device;
+            topic->publish(sample);
+        }
+        const size_t count = topic->read_multiple(token, out.get(), 16);
+        for (size_t i = 0; i < count; ++i) kept += out[i].device_id == 3;
+    }
+    benchmark::DoNotOptimize(kept);
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+
+template<size_t Bytes>
+static void BM_FanIn_Filtered(benchmark::State& state) {
+    using Msg = FanInSample<Bytes>;
+    auto topic = std::make_unique<mreq::Topic<Msg, 16>>();
+    auto out = std::make_unique<Msg[]>(16);
+    Token token = topic->subscribe(mreq::SubscribeOptions::matching(
+        mreq::field_equals<&Msg::device_id>(3))).value();
+    Msg sample{};
+    size_t kept = 0;
+    for (auto _ : state) {
+        for (uint32_t device = 0; device < 16; ++device) {
+            sample.device_id = device;
+            topic->publish(sample);
+        }
+        kept += topic->read_multiple(token, out.get(), 16);
+    }
+    benchmark::DoNotOptimize(kept);
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+
+BENCHMARK_TEMPLATE(BM_FanIn_Discard, 32);
+BENCHMARK_TEMPLATE(BM_FanIn_Filtered, 32);
+BENCHMARK_TEMPLATE(BM_FanIn_Discard, 1024);
+BENCHMARK_TEMPLATE(BM_FanIn_Filtered, 1024);
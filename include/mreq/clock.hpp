@@ -0,0 +1,11 @@
+#pragma once
+
+#ifdef MREQ_PLATFORM_BAREMETAL
+    #include "mreq/platform/baremetal/clock.hpp"
+#elif defined(MREQ_PLATFORM_FREERTOS)
+    #include "mreq/platform/freertos/clock.hpp"
+#elif defined(MREQ_PLATFORM_POSIX)
+    #include "mreq/platform/posix/clock.hpp"
+#else
+    #error "No platform selected! Define MREQ_PLATFORM_(BAREMETAL|FREERTOS|POSIX)"
+#endif
@@ -0,0 +1,305 @@
+#pragma once
+
+#ifndef MREQ_ENABLE_COROUTINES
+#error "mreq/coroutine.hpp MREQ_ENABLE_COROUTINES gerektirir (CMake: -DMREQ_ENABLE_COROUTINES=ON)"
+#endif
+#if !defined(__cpp_impl_coroutine)
+#error "mreq coroutine katmanı C++20 coroutine desteği gerektirir"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include "mreq/event.hpp"
+#include "mreq/internal/NonCopyable.hpp"
+#include "mreq/internal/TopicListeners.hpp"
+
+// Bir Executor'ın aynı anda bekleyebileceği farklı topic sayısı
+#ifndef MREQ_EXECUTOR_MAX_TOPICS
+#define MREQ_EXECUTOR_MAX_TOPICS 32
+#endif
+
+using Token = size_t;
+
+namespace mreq {
+
+class Executor;
+
+// Executor üzerinde çalışan tüketici coroutine'i. Gövde spawn() ile executor'a verilene
+// kadar başlamaz; bittiğinde frame'i executor yok eder. Sadece mreq awaitable'larını
+// (topic.next()) co_await edebilir ve başka bir Task'ı beklemez.
+class Task {
+public:
+    struct promise_type {
+        Executor* executor = nullptr;
+        promise_type* next = nullptr;                       // Hazır kuyruğu ya da topic bekleme listesi
+        void* topic = nullptr;                              // Beklenen (topic, token)
+        Token token = 0;
+        bool (*check_fn)(void*, Token) = nullptr;
+
+        Task get_return_object() noexcept {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task(Task&& other) noexcept : handle_(other.handle_) { other.handle_ = nullptr; }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&&) = delete;
+    ~Task() { if (handle_) handle_.destroy(); }
+
+private:
+    friend class Executor;
+    explicit Task(handle_type handle) : handle_(handle) {}
+
+    handle_type release() noexcept {
+        handle_type handle = handle_;
+        handle_ = nullptr;
+        return handle;
+    }
+
+    handle_type handle_;
+};
+
+// Tek thread'li coroutine yürütücüsü: yüzlerce tüketici tek thread'i paylaşır.
+// Beklenen her topic'e tek bir listener bağlanır; publish sadece topic'in hazır bitini
+// işaretler ve executor uyuyorsa onu uyandırır. Executor sadece işaretli topic'lerin
+// bekleyenlerini check() ile dener ve mesajı olanları sırayla devam ettirir.
+// spawn()/poll()/run() tek bir sahip thread'den çağrılmalıdır; publish ve stop() herhangi
+// bir thread'den gelebilir. Yok edildiğinde bitmemiş tüm Task frame'leri yok edilir.
+class Executor : private internal::NonCopyable {
+public:
+    static constexpr size_t kMaxTopics = MREQ_EXECUTOR_MAX_TOPICS;
+
+private:
+    using Promise = Task::promise_type;
+    using Handle = Task::handle_type;
+
+    static constexpr size_t kWordBits = 32;
+    static constexpr size_t kWords = (kMaxTopics + kWordBits - 1) / kWordBits;
+    // Uyurken stop()/publish kaçırılsa bile döngünün kendini yoklama aralığı
+    static constexpr uint32_t kIdleTimeoutMs = 100;
+
+    struct Watch {
+        void* topic = nullptr;
+        void (*detach_fn)(void*, const internal::TopicListener*) = nullptr;
+        internal::TopicListener listener{};
+        Promise* waiters = nullptr;
+    };
+
+    Watch watches_[kMaxTopics];
+    std::atomic<uint32_t> signaled_[kWords] = {};    // publish tarafından işaretlenir
+    Promise* ready_head_ = nullptr;
+    Promise* ready_tail_ = nullptr;
+    size_t live_ = 0;
+    std::atomic<bool> waiting_{false};
+    std::atomic<bool> stop_{false};
+    Event event_;
+
+    static uint32_t bit_of(size_t index) {
+        return 1u << (index % kWordBits);
+    }
+
+    // Publisher thread'inden çağrılır
+    static void on_publish(void* context, size_t index) {
+        Executor* self = static_cast<Executor*>(context);
+        const uint32_t mask = bit_of(index);
+        const uint32_t prev = self->signaled_[index / kWordBits].fetch_or(mask);
+        if (!(prev & mask) && self->waiting_.load()) {
+            self->event_.notify();
+        }
+    }
+
+    void push_ready(Promise* promise) {
+        promise->next = nullptr;
+        if (ready_tail_) {
+            ready_tail_->next = promise;
+        } else {
+            ready_head_ = promise;
+        }
+        ready_tail_ = promise;
+    }
+
+    // Topic'in izleme girişini bulur ya da listener bağlayarak oluşturur (attached = true)
+    Watch* watch_for(void* topic, bool (*attach_fn)(void*, const internal::TopicListener*),
+                     void (*detach_fn)(void*, const internal::TopicListener*), bool& attached) {
+        attached = false;
+        Watch* free_watch = nullptr;
+        for (size_t i = 0; i < kMaxTopics; ++i) {
+            Watch& watch = watches_[i];
+            if (watch.topic == topic) return &watch;
+            if (!watch.topic && !free_watch) free_watch = &watch;
+        }
+        if (!free_watch) return nullptr;
+
+        const size_t index = static_cast<size_t>(free_watch - watches_);
+        free_watch->listener = {&Executor::on_publish, this, index};
+        if (!attach_fn(topic, &free_watch->listener)) return nullptr;
+        free_watch->topic = topic;
+        free_watch->detach_fn = detach_fn;
+        attached = true;
+        return free_watch;
+    }
+
+    // İşaretli topic'lerin bekleyenlerinden mesajı olanları hazır kuyruğuna taşır
+    void collect_signaled() {
+        for (size_t w = 0; w < kWords; ++w) {
+            uint32_t bits = signaled_[w].exchange(0);
+            while (bits) {
+                const size_t index = w * kWordBits + static_cast<size_t>(__builtin_ctz(bits));
+                bits &= bits - 1;
+                Promise** link = &watches_[index].waiters;
+                while (Promise* promise = *link) {
+                    if (promise->check_fn(promise->topic, promise->token)) {
+                        *link = promise->next;
+                        push_ready(promise);
+                    } else {
+                        link = &promise->next;
+                    }
+                }
+            }
+        }
+    }
+
+    bool any_signaled() const {
+        for (size_t w = 0; w < kWords; ++w) {
+            if (signaled_[w].load() != 0) return true;
+        }
+        return false;
+    }
+
+    void resume(Promise* promise) {
+        Handle handle = Handle::from_promise(*promise);
+        handle.resume();
+        if (handle.done()) {
+            handle.destroy();
+            --live_;
+        }
+    }
+
+    static void destroy_list(Promise* promise) {
+        while (promise) {
+            Promise* next = promise->next;
+            Handle::from_promise(*promise).destroy();
+            promise = next;
+        }
+    }
+
+public:
+    Executor() = default;
+
+    ~Executor() {
+        for (Watch& watch : watches_) {
+            if (!watch.topic) continue;
+            watch.detach_fn(watch.topic, &watch.listener);
+            destroy_list(watch.waiters);
+        }
+        destroy_list(ready_head_);
+    }
+
+    // Task'ı executor'a verir; ilk poll()/run() turunda başlar
+    void spawn(Task task) {
+        Handle handle = task.release();
+        if (!handle) return;
+        handle.promise().executor = this;
+        ++live_;
+        push_ready(&handle.promise());
+    }
+
+    // Bloklamadan: mesajı gelen ve yeni eklenen Task'ları devam ettirir; devam ettirilen sayıyı döndürür
+    size_t poll() {
+        collect_signaled();
+        size_t resumed = 0;
+        while (Promise* promise = ready_head_) {
+            ready_head_ = promise->next;
+            if (!ready_head_) ready_tail_ = nullptr;
+            resume(promise);
+            ++resumed;
+        }
+        return resumed;
+    }
+
+    // Tüm Task'lar bitene ya da stop() çağrılana kadar çalışır; iş yokken publish'e kadar uyur.
+    // run() başlamadan gelen stop() kaybolmaz: bekleyen stop'u tüketen run() hemen döner.
+    void run() {
+        while (live_ > 0) {
+            if (stop_.exchange(false)) return;
+            if (poll() > 0) continue;
+            waiting_.store(true);
+            // waiting_ işaretlendikten sonra tekrar bak: araya giren publish kaçmasın
+            if (!any_signaled() && !stop_.load()) {
+                event_.wait_for(kIdleTimeoutMs);
+            }
+            waiting_.store(false);
+        }
+    }
+
+    // Herhangi bir thread'den: çalışan ya da sıradaki run() döngüsünü sonlandırır
+    void stop() {
+        stop_.store(true);
+        event_.notify();
+    }
+
+    // Bitmemiş Task sayısı
+    size_t task_count() const noexcept { return live_; }
+
+    // topic.next() tarafından çağrılır: promise'i (topic, token) için bekleme listesine ekler.
+    // Mesaj zaten varsa ya da topic izlenemiyorsa false döner (Task askıya alınmaz).
+    bool wait(Promise& promise, void* topic, Token token, bool (*check_fn)(void*, Token),
+              bool (*attach_fn)(void*, const internal::TopicListener*),
+              void (*detach_fn)(void*, const internal::TopicListener*)) {
+        bool attached;
+        Watch* watch = watch_for(topic, attach_fn, detach_fn, attached);
+        if (!watch) return false;
+        // Listener bağlanmadan önce yayınlanan mesaj kaçmasın. Listener zaten bağlıysa
+        // await_ready() sonrası gelen publish hazır bitini işaretlemiştir; collect_signaled()
+        // bu promise'i listede bulur.
+        if (attached && check_fn(topic, token)) return false;
+        promise.topic = topic;
+        promise.token = token;
+        promise.check_fn = check_fn;
+        promise.next = watch->waiters;
+        watch->waiters = &promise;
+        return true;
+    }
+};
+
+// co_await topic.next(token): abonenin okunmamış mesajı yoksa Task'ı publish'e kadar askıya
+// alır, sonra mesajı read() ile döndürür. std::nullopt: token geçersiz ya da executor
+// topic'i izleyemedi (MREQ_EXECUTOR_MAX_TOPICS / MREQ_MAX_LISTENERS dolu).
+template<typename TopicT>
+class NextAwaiter {
+public:
+    NextAwaiter(TopicT& topic, Token token) noexcept : topic_(topic), token_(token) {}
+
+    bool await_ready() const noexcept {
+        return topic_.check(token_);
+    }
+
+    bool await_suspend(Task::handle_type handle) {
+        Task::promise_type& promise = handle.promise();
+        // Geçersiz token'ın mesajı hiç gelmez: askıya almadan await_resume() std::nullopt döner
+        if (!promise.executor || !topic_.subscribed(token_)) return false;
+        return promise.executor->wait(promise, &topic_, token_, &TopicT::static_check,
+                                      &TopicT::static_attach_listener, &TopicT::static_detach_listener);
+    }
+
+    std::optional<typename TopicT::value_type> await_resume() {
+        return topic_.read(token_);
+    }
+
+private:
+    TopicT& topic_;
+    Token token_;
+};
+
+} // namespace mreq
@@ -0,0 +1,60 @@
+#ifndef MREQ_BACKOFF_HPP
+#define MREQ_BACKOFF_HPP
+
+#include <cstdint>
+
+#ifdef MREQ_PLATFORM_POSIX
+#include <sched.h>
+#endif
+
+namespace mreq {
+namespace internal {
+
+/**
+ * @brief Hint to the CPU that the caller is busy-waiting.
+ *
+ * Reduces power and pipeline pressure inside spin loops; a no-op on targets without a
+ * dedicated instruction.
+ */
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * @brief Bounded exponential backoff for lock-free retry loops.
+ *
+ * Spins with `cpu_relax()` for a growing number of iterations, then yields the CPU on
+ * platforms with a scheduler so a preempted peer can make progress.
+ */
+class Backoff {
+ public:
+  void pause() noexcept {
+    if (spins_ < kSpinLimit) {
+      for (uint32_t i = 0; i < (1u << spins_); ++i) {
+        cpu_relax();
+      }
+      ++spins_;
+      return;
+    }
+#ifdef MREQ_PLATFORM_POSIX
+    sched_yield();
+#else
+    cpu_relax();
+#endif
+  }
+
+  void reset() noexcept { spins_ = 0; }
+
+ private:
+  static constexpr uint32_t kSpinLimit = 6;
+  uint32_t spins_ = 0;
+};
+
+} // namespace internal
+} // namespace mreq
+
+#endif // MREQ_BACKOFF_HPP
@@ -0,0 +1,48 @@
+#ifndef MREQ_CACHELINE_HPP
+#define MREQ_CACHELINE_HPP
+
+#include <cstddef>
+#include <new>
+
+/**
+ * @file CacheLine.hpp
+ * @brief Optional cache-line-aware layout for topics and subscriber tables.
+ *
+ * With MREQ_CACHE_ALIGNED_LAYOUT defined, writer-owned topic fields, each subscriber slot
+ * and each lock-free ring slot start on their own cache line, so readers updating their
+ * cursors on different cores do not false-share with each other or with the writer.
+ * Without it (the default) MREQ_CACHE_ALIGNED expands to nothing and the compact layout
+ * is kept for memory-constrained targets.
+ *
+ * MREQ_CACHE_LINE_SIZE can be set explicitly; otherwise
+ * std::hardware_destructive_interference_size is used where available, else 64.
+ */
+
+namespace mreq {
+namespace internal {
+
+#if defined(MREQ_CACHE_LINE_SIZE)
+inline constexpr size_t kCacheLineSize = MREQ_CACHE_LINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr size_t kCacheLineSize = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr size_t kCacheLineSize = 64;
+#endif
+
+}  // namespace internal
+}  // namespace mreq
+
+#ifdef MREQ_CACHE_ALIGNED_LAYOUT
+#define MREQ_CACHE_ALIGNED alignas(::mreq::internal::kCacheLineSize)
+#else
+#define MREQ_CACHE_ALIGNED
+#endif
+
+#endif  // MREQ_CACHELINE_HPP
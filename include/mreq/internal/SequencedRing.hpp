@@ -0,0 +1,140 @@
+#ifndef MREQ_SEQUENCEDRING_HPP
+#define MREQ_SEQUENCEDRING_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "mreq/internal/Backoff.hpp"
+#include "mreq/internal/CacheLine.hpp"
+
+namespace mreq {
+namespace internal {
+
+/**
+ * @brief Lock-free multi-producer ring with per-slot commit counters.
+ *
+ * Producers claim a sequence number with an atomic fetch-add on `claimed` and publish the
+ * message through the slot's commit counter. Each reader owns a cursor (the sequence number
+ * of the last message it consumed) and follows the stream in sequence order, stopping at the
+ * first message that is not committed yet, so every reader sees a consistent ordered stream.
+ *
+ * The structure holds only lock-free atomics and trivially copyable payloads, so it can be
+ * placed in memory shared between processes.
+ *
+ * Slot sequence encoding: 0 = empty, 2*s - 1 = message s being written, 2*s = message s committed.
+ *
+ * @tparam T Message type (must be trivially copyable).
+ * @tparam N Ring capacity.
+ */
+template <typename T, size_t N>
+struct SequencedRing {
+  static_assert(N >= 1, "Buffer boyutu en az 1 olmalı");
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SequencedRing mesaj tipinin trivially copyable olmasını gerektirir");
+  static_assert(std::atomic<size_t>::is_always_lock_free, "size_t atomikleri kilitsiz olmalı");
+
+  struct MREQ_CACHE_ALIGNED Slot {
+    std::atomic<size_t> seq{0};
+    T data{};
+  };
+
+  std::array<Slot, N> slots{};
+  MREQ_CACHE_ALIGNED std::atomic<size_t> claimed{0};  ///< Sequence number of the last claimed message.
+
+  /// Sequence number of the last claimed (not necessarily committed) message.
+  size_t head() const noexcept { return claimed.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Publishes a message; safe to call from any number of producers concurrently.
+   *
+   * A producer only waits for the producer N messages earlier to finish with the same slot.
+   * @return The sequence number assigned to the message.
+   */
+  size_t publish(const T& msg) noexcept {
+    const size_t seq = claimed.fetch_add(1, std::memory_order_acq_rel) + 1;
+    write(seq, msg);
+    return seq;
+  }
+
+  /// Writes and commits the message with the already claimed sequence number `seq`.
+  void write(size_t seq, const T& msg) noexcept {
+    Slot& slot = slots[(seq - 1) % N];
+
+    // Slotun önceki sahibi (seq - N) commit edene kadar bekle
+    const size_t expected = seq > N ? 2 * (seq - N) : 0;
+    Backoff backoff;
+    while (slot.seq.load(std::memory_order_acquire) != expected) {
+      backoff.pause();
+    }
+
+    slot.seq.store(2 * seq - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&slot.data, &msg, sizeof(T));
+    slot.seq.store(2 * seq, std::memory_order_release);
+  }
+
+  /**
+   * @brief Publishes `count` messages under consecutive sequence numbers with a single claim.
+   * @return The sequence number assigned to the last message.
+   */
+  size_t publish_multiple(const T* msgs, size_t count) noexcept {
+    const size_t first = claimed.fetch_add(count, std::memory_order_acq_rel) + 1;
+    for (size_t i = 0; i < count; ++i) {
+      write(first + i, msgs[i]);
+    }
+    return first + count - 1;
+  }
+
+  /// Wait-free: is the message after `cursor` committed (or already overwritten)?
+  bool has_next(const std::atomic<size_t>& cursor) const noexcept {
+    const size_t next = cursor.load(std::memory_order_relaxed) + 1;
+    return slots[(next - 1) % N].seq.load(std::memory_order_acquire) >= 2 * next;
+  }
+
+  /**
+   * @brief Copies the message after `cursor` into `out` and advances the cursor.
+   *
+   * Lapped readers jump to the oldest message still in the ring; messages overwritten while
+   * being copied are skipped.
+   * @return false if the next message is not committed yet.
+   */
+  bool try_read_next(std::atomic<size_t>& cursor, T& out) const noexcept {
+    for (;;) {
+      const size_t last_read_seq = cursor.load(std::memory_order_relaxed);
+      const size_t next = last_read_seq + 1;
+      const Slot& slot = slots[(next - 1) % N];
+
+      const size_t before = slot.seq.load(std::memory_order_acquire);
+      if (before < 2 * next) {
+        return false; // Henüz commit edilmedi (veya yazılıyor): sıra korunur
+      }
+      if (before > 2 * next) {
+        // Okuyucu geride kaldı (slot en az next + N. mesajı taşıyor): en eski olası mesaja atla
+        // (claimed henüz güncel görünmüyorsa en azından bu mesajı atla)
+        const size_t head_seq = claimed.load(std::memory_order_acquire);
+        const size_t oldest = head_seq > N ? head_seq - N : 0;
+        cursor.store(oldest > next ? oldest : next, std::memory_order_relaxed);
+        continue;
+      }
+
+      std::memcpy(&out, &slot.data, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (slot.seq.load(std::memory_order_relaxed) != before) {
+        // Yırtık okuma: kopyalama sırasında üzerine yazıldı, mesaj kayıp
+        cursor.store(next, std::memory_order_relaxed);
+        continue;
+      }
+
+      cursor.store(next, std::memory_order_relaxed);
+      return true;
+    }
+  }
+};
+
+} // namespace internal
+} // namespace mreq
+
+#endif // MREQ_SEQUENCEDRING_HPP
@@ -0,0 +1,101 @@
+#ifndef MREQ_TOPICLISTENERS_HPP
+#define MREQ_TOPICLISTENERS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include "mreq/internal/Backoff.hpp"
+
+// Bir topic'e aynı anda bağlanabilecek dinleyici (WaitSet vb.) sayısı
+#ifndef MREQ_MAX_LISTENERS
+#define MREQ_MAX_LISTENERS 4
+#endif
+
+namespace mreq {
+namespace internal {
+
+/**
+ * @brief Publish notification target (e.g. one WaitSet entry).
+ *
+ * `notify(context, id)` is invoked from the publishing thread after a message becomes
+ * visible to readers, so it must be short and must not call back into the topic.
+ */
+struct TopicListener {
+  void (*notify)(void* context, size_t id);
+  void* context;
+  size_t id;
+};
+
+/**
+ * @brief Fixed-size, lock-free set of listeners owned by a topic.
+ *
+ * Publishing without listeners costs one fence and a relaxed load. `detach()` waits for notifications
+ * already in flight, so the listener may be destroyed as soon as it returns.
+ *
+ * In-flight notifications are counted per epoch: `detach()` flips the epoch and waits only for the
+ * counter of the previous one, so notifications started afterwards (which can no longer see the
+ * listener) do not hold it back and continuous publishing cannot starve it.
+ */
+class TopicListeners {
+ public:
+  /// @return false if all MREQ_MAX_LISTENERS slots are taken.
+  bool attach(const TopicListener* listener) noexcept {
+    for (auto& slot : slots_) {
+      const TopicListener* expected = nullptr;
+      if (slot.compare_exchange_strong(expected, listener)) {
+        count_.fetch_add(1);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void detach(const TopicListener* listener) noexcept {
+    for (auto& slot : slots_) {
+      const TopicListener* expected = listener;
+      if (slot.compare_exchange_strong(expected, nullptr)) {
+        count_.fetch_sub(1);
+        break;
+      }
+    }
+    // Listener'ı okumuş olabilecek notify() çağrıları epoch çevrilmeden önce sayılmıştır.
+    // Epoch'u aynı anda tek detach() çevirir; böylece eski sayaca yeni notify() eklenmez.
+    Backoff backoff;
+    while (detaching_.exchange(true, std::memory_order_acquire)) {
+      backoff.pause();
+    }
+    const size_t previous = epoch_.fetch_xor(1);
+    backoff.reset();
+    while (notifying_[previous].load() != 0) {
+      backoff.pause();
+    }
+    detaching_.store(false, std::memory_order_release);
+  }
+
+  void notify() const noexcept {
+    // Yayınlanan sequence ile count_ okuması yer değiştirmesin: attach() sonrası check()
+    // mesajı görmüyorsa bu publish listener'ı görür
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (count_.load(std::memory_order_relaxed) == 0) return;
+
+    std::atomic<size_t>& notifying = notifying_[epoch_.load()];
+    notifying.fetch_add(1);
+    for (const auto& slot : slots_) {
+      if (const TopicListener* listener = slot.load()) {
+        listener->notify(listener->context, listener->id);
+      }
+    }
+    notifying.fetch_sub(1);
+  }
+
+ private:
+  std::atomic<const TopicListener*> slots_[MREQ_MAX_LISTENERS] = {};
+  std::atomic<size_t> count_{0};
+  std::atomic<size_t> epoch_{0};
+  std::atomic<bool> detaching_{false};
+  mutable std::atomic<size_t> notifying_[2] = {};
+};
+
+} // namespace internal
+} // namespace mreq
+
+#endif // MREQ_TOPICLISTENERS_HPP
@@ -0,0 +1,109 @@
+#ifndef MREQ_TOPICOPS_HPP
+#define MREQ_TOPICOPS_HPP
+
+#include <cstddef>
+#include <optional>
+#include "mreq/internal/TopicListeners.hpp"
+#include "mreq/read_info.hpp"
+#include "mreq/topic_stats.hpp"
+#ifdef MREQ_ENABLE_COROUTINES
+#include "mreq/coroutine.hpp"
+#endif
+
+using Token = size_t;
+
+namespace mreq {
+namespace internal {
+
+/**
+ * @brief CRTP base providing the type-erased entry points stored in `mreq_metadata`.
+ *
+ * Every topic implementation (mutex based `Topic`, `SeqlockTopic`, ...) exposes the same
+ * member API; deriving from this class generates the matching `static_*` trampolines so
+ * any of them can be bound to a metadata function-pointer table without virtual calls.
+ *
+ * @tparam Derived The concrete topic class.
+ * @tparam T       The message type carried by the topic.
+ */
+template <typename Derived, typename T>
+class TopicOps {
+ public:
+  static std::optional<Token> static_subscribe(void* topic_ptr) {
+    return static_cast<Derived*>(topic_ptr)->subscribe();
+  }
+
+  static void static_unsubscribe(void* topic_ptr, Token token) {
+    static_cast<Derived*>(topic_ptr)->unsubscribe(token);
+  }
+
+  static bool static_check(void* topic_ptr, Token token) {
+    return static_cast<Derived*>(topic_ptr)->check(token);
+  }
+
+  static void static_publish(void* topic_ptr, const void* data) {
+    static_cast<Derived*>(topic_ptr)->publish(*static_cast<const T*>(data));
+  }
+
+  static void static_publish_multiple(void* topic_ptr, const void* data, size_t count) {
+    static_cast<Derived*>(topic_ptr)->publish_multiple(static_cast<const T*>(data), count);
+  }
+
+  static void* static_read(void* topic_ptr, Token token, void* result) {
+    auto opt_result = static_cast<Derived*>(topic_ptr)->read(token);
+    if (opt_result.has_value()) {
+      *static_cast<T*>(result) = *opt_result;
+      return result;
+    }
+    return nullptr;
+  }
+
+  static size_t static_read_multiple(void* topic_ptr, Token token, void* buffer, size_t count) {
+    return static_cast<Derived*>(topic_ptr)->read_multiple(token, static_cast<T*>(buffer), count);
+  }
+
+  static void* static_read_info(void* topic_ptr, Token token, void* result, ReadInfo* info) {
+    auto opt_result = static_cast<Derived*>(topic_ptr)->read(token, *info);
+    if (opt_result.has_value()) {
+      *static_cast<T*>(result) = *opt_result;
+      return result;
+    }
+    return nullptr;
+  }
+
+  static size_t static_read_multiple_info(void* topic_ptr, Token token, void* buffer, size_t count,
+                                          ReadInfo* info) {
+    return static_cast<Derived*>(topic_ptr)->read_multiple(token, static_cast<T*>(buffer), count, *info);
+  }
+
+  static bool static_attach_listener(void* topic_ptr, const TopicListener* listener) {
+    return static_cast<Derived*>(topic_ptr)->attach_listener(listener);
+  }
+
+  static void static_detach_listener(void* topic_ptr, const TopicListener* listener) {
+    static_cast<Derived*>(topic_ptr)->detach_listener(listener);
+  }
+
+  static void static_stats(void* topic_ptr, TopicStatsSnapshot* out) {
+    static_cast<Derived*>(topic_ptr)->stats(*out);
+  }
+
+#ifdef MREQ_ENABLE_COROUTINES
+  /**
+   * @brief Awaitable for the subscriber's next message (`co_await topic.next(token)`).
+   *
+   * Only valid inside an `mreq::Task` running on an `mreq::Executor`.
+   */
+  NextAwaiter<Derived> next(Token token) noexcept {
+    return NextAwaiter<Derived>(*static_cast<Derived*>(this), token);
+  }
+#endif
+
+ protected:
+  TopicOps() = default;
+  ~TopicOps() = default;
+};
+
+} // namespace internal
+} // namespace mreq
+
+#endif // MREQ_TOPICOPS_HPP
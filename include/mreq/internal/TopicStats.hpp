@@ -0,0 +1,169 @@
+#ifndef MREQ_TOPICSTATS_HPP
+#define MREQ_TOPICSTATS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "mreq/clock.hpp"
+#include "mreq/topic_stats.hpp"
+
+namespace mreq {
+namespace internal {
+
+#ifdef MREQ_ENABLE_STATS
+
+/**
+ * @brief Per-topic runtime counters, maintained with relaxed atomics.
+ *
+ * Lock wait time is only measured when the lock is contended (`try_lock` fails), so an
+ * uncontended operation pays no clock reads; publish reads the clock once for
+ * `last_publish_ns`.
+ *
+ * @tparam MaxSubscribers Subscriber capacity of the owning topic.
+ */
+template <size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS>
+class TopicStats {
+ public:
+  void on_publish(size_t count = 1) noexcept {
+    published_.fetch_add(count, std::memory_order_relaxed);
+    last_publish_ns_.store(now_ns(), std::memory_order_relaxed);
+  }
+
+  void on_subscribe(size_t token) noexcept {
+    SubscriberCounters* sub = counters(token);
+    if (!sub) return;
+    sub->read.store(0, std::memory_order_relaxed);
+    sub->lost.store(0, std::memory_order_relaxed);
+  }
+
+  /// @param read Messages delivered; @param lost Messages skipped because they were overwritten.
+  void on_read(size_t token, size_t read, size_t lost) noexcept {
+    SubscriberCounters* sub = counters(token);
+    if (!sub) return;
+    if (read) sub->read.fetch_add(read, std::memory_order_relaxed);
+    if (lost) sub->lost.fetch_add(lost, std::memory_order_relaxed);
+  }
+
+  /// Locks `m`, accounting the wait if the lock is contended.
+  template <typename MutexType>
+  void lock(MutexType& m) noexcept {
+    if (m.try_lock()) return;
+    const uint64_t start = monotonic_ns();
+    m.lock();
+    lock_wait_ns_.fetch_add(monotonic_ns() - start, std::memory_order_relaxed);
+  }
+
+  /// Fills the topic-level counters and the counters of `out.subscribers[0..subscriber_count)`.
+  void fill(TopicStatsSnapshot& out) const noexcept {
+    out.enabled = true;
+    out.published = published_.load(std::memory_order_relaxed);
+    out.lock_wait_ns = lock_wait_ns_.load(std::memory_order_relaxed);
+    out.last_publish_ns = last_publish_ns_.load(std::memory_order_relaxed);
+    out.read = 0;
+    out.lost = 0;
+    for (size_t i = 0; i < out.subscriber_count; ++i) {
+      SubscriberStats& sub = out.subscribers[i];
+      if (sub.token >= MaxSubscribers) continue;
+      sub.read = subscribers_[sub.token].read.load(std::memory_order_relaxed);
+      sub.lost = subscribers_[sub.token].lost.load(std::memory_order_relaxed);
+      out.read += sub.read;
+      out.lost += sub.lost;
+    }
+  }
+
+ private:
+  struct SubscriberCounters {
+    std::atomic<uint64_t> read{0};
+    std::atomic<uint64_t> lost{0};
+  };
+
+  /**
+   * @brief Counters of `token`, nullptr if out of range.
+   *
+   * The bound is checked where the array is indexed: with an early return in the callers GCC
+   * splits the unchecked remainder into a part function that is identical for every
+   * MaxSubscribers, folds the copies, and then reports -Warray-bounds on smaller topics.
+   */
+  SubscriberCounters* counters(size_t token) noexcept {
+    return token < MaxSubscribers ? &subscribers_[token] : nullptr;
+  }
+
+  std::atomic<uint64_t> published_{0};
+  std::atomic<uint64_t> lock_wait_ns_{0};
+  std::atomic<uint64_t> last_publish_ns_{0};
+  SubscriberCounters subscribers_[MaxSubscribers];
+};
+
+#else
+
+/// Statistics disabled: every hook compiles away.
+template <size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS>
+class TopicStats {
+ public:
+  void on_publish(size_t = 1) noexcept {}
+  void on_subscribe(size_t) noexcept {}
+  void on_read(size_t, size_t, size_t) noexcept {}
+
+  template <typename MutexType>
+  void lock(MutexType& m) noexcept { m.lock(); }
+
+  void fill(TopicStatsSnapshot& out) const noexcept {
+    out.enabled = false;
+    out.published = out.read = out.lost = 0;
+    out.lock_wait_ns = out.last_publish_ns = 0;
+  }
+};
+
+#endif // MREQ_ENABLE_STATS
+
+/**
+ * @brief Fills `out.subscribers` with the lag of every active subscriber slot.
+ *
+ * Shared by all topic classes; the lag is reported whether or not MREQ_ENABLE_STATS is
+ * defined. At most MREQ_STATS_MAX_SUBSCRIBERS entries are written.
+ *
+ * @param slots Subscriber table (`capacity()` / `get_slot(i)`) or a plain slot array; each slot
+ *              exposes atomic `active` and `last_read_seq` members.
+ * @param seq   Current sequence number of the topic.
+ */
+template <typename Slots>
+void fill_subscriber_lag(const Slots& slots, size_t seq, TopicStatsSnapshot& out) noexcept {
+  out.subscriber_count = 0;
+  auto add = [&](size_t index, const auto& slot) {
+    if (!slot.active.load(std::memory_order_relaxed)) return;
+    const size_t last_read_seq = slot.last_read_seq.load(std::memory_order_relaxed);
+    out.subscribers[out.subscriber_count++] = {index, 0, 0, seq > last_read_seq ? seq - last_read_seq : 0};
+  };
+  if constexpr (std::is_array_v<Slots>) {
+    for (size_t i = 0; i < std::extent_v<Slots> && out.subscriber_count < MREQ_STATS_MAX_SUBSCRIBERS; ++i) {
+      add(i, slots[i]);
+    }
+  } else {
+    for (size_t i = 0; i < slots.capacity() && out.subscriber_count < MREQ_STATS_MAX_SUBSCRIBERS; ++i) {
+      add(i, slots.get_slot(i));
+    }
+  }
+}
+
+/**
+ * @brief LockGuard variant that reports contended lock waits to a TopicStats.
+ */
+template <typename MutexType>
+class StatsLockGuard {
+ public:
+  template <typename StatsType>
+  StatsLockGuard(MutexType& m, StatsType& stats) : mutex_(m) { stats.lock(mutex_); }
+  ~StatsLockGuard() { mutex_.unlock(); }
+
+  StatsLockGuard(const StatsLockGuard&) = delete;
+  StatsLockGuard& operator=(const StatsLockGuard&) = delete;
+
+ private:
+  MutexType& mutex_;
+};
+
+} // namespace internal
+} // namespace mreq
+
+#endif // MREQ_TOPICSTATS_HPP
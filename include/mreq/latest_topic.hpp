@@ -0,0 +1,236 @@
+#pragma once
+#include <optional>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "subscriber_table.hpp"
+#include "mreq/internal/CacheLine.hpp"
+#include "mreq/internal/TopicOps.hpp"
+#include "mreq/internal/TopicStats.hpp"
+
+using Token = size_t;
+
+namespace mreq {
+
+struct mreq_metadata;
+
+// Sadece en güncel değeri tutan, tek yazıcılı, kilitsiz "durum" topic'i (triple buffer).
+// Yazıcı her zaman serbest bir tampona yazar ve onu tek atomik store ile "en güncel" yapar;
+// hiç beklemez ve tekrar denemez. Okuyucu en güncel tamponu sayaçla sabitler (pin), kopyalar
+// ve bırakır; yazıcı sabitlenmiş tampona yazmaz, bu yüzden okuma hiçbir zaman yırtık olmaz.
+// Her okuyucu en fazla bir tampon sabitleyebildiği için MaxSubscribers + 2 tampon yazıcının
+// her zaman serbest tampon bulmasını garanti eder (tek aboneyle klasik triple buffer).
+// read() sadece en son mesajı verir; aradaki mesajlar ReadInfo::dropped ile bildirilir.
+// Aynı topic'e birden fazla thread publish ETMEMELİDİR; aynı token'dan eşzamanlı okunmamalıdır.
+template<typename T, size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS>
+class LatestTopic : public internal::TopicOps<LatestTopic<T, MaxSubscribers>, T> {
+public:
+    using value_type = T;
+private:
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "LatestTopic mesaj tipinin trivially copyable olmasını gerektirir");
+
+    static constexpr size_t kBuffers = MaxSubscribers + 2;
+    // state_ = (sequence << kIndexBits) | en güncel tamponun indeksi: tek atomik yayın
+    static constexpr unsigned kIndexBits = 16;
+    static constexpr uint64_t kIndexMask = (uint64_t{1} << kIndexBits) - 1;
+    static_assert(kBuffers <= kIndexMask, "LatestTopic abone kapasitesi çok büyük");
+
+    struct MREQ_CACHE_ALIGNED Buffer {
+        mutable std::atomic<uint32_t> readers{0};   // Tamponu sabitlemiş okuyucu sayısı
+        T data{};
+    };
+
+    std::array<Buffer, kBuffers> buffers_{};
+    MREQ_CACHE_ALIGNED std::atomic<uint64_t> state_{0};
+    uint32_t back_ = 1;                                     // Yazıcının sıradaki tamponu (sadece yazıcı)
+    mutable SubscriberTable<T, MaxSubscribers> subscribers_;
+    internal::TopicListeners listeners_;
+    mutable internal::TopicStats<MaxSubscribers> stats_;
+
+    // Metadata pointer for this topic instance
+    const mreq_metadata* metadata_ = nullptr;
+
+    static size_t sequence_of(uint64_t state) noexcept { return static_cast<size_t>(state >> kIndexBits); }
+    static uint32_t index_of(uint64_t state) noexcept { return static_cast<uint32_t>(state & kIndexMask); }
+
+    // state'teki tamponu sabitler. Sabitleme ile state_ kontrolü arasında yeni mesaj
+    // yayınlandıysa (tampon yeniden kullanılıyor olabilir) bırakıp en güncel durumla yeniden
+    // dener. seq_cst: yazıcının serbest tampon taramasındaki readers okuması bu artışı görmelidir.
+    uint64_t pin(uint64_t state) const noexcept {
+        for (;;) {
+            const Buffer& buffer = buffers_[index_of(state)];
+            buffer.readers.fetch_add(1, std::memory_order_seq_cst);
+            const uint64_t current = state_.load(std::memory_order_seq_cst);
+            if (current == state) return state;
+            buffer.readers.fetch_sub(1, std::memory_order_release);
+            state = current;
+        }
+    }
+
+    void unpin(uint32_t index) const noexcept {
+        buffers_[index].readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    size_t sequence() const noexcept {
+        return sequence_of(state_.load(std::memory_order_acquire));
+    }
+
+    // back_ tamponunu count mesaj ilerletilmiş sequence ile yayınlar ve sıradaki serbest tamponu seçer
+    void commit(size_t count) noexcept {
+        const uint32_t published = back_;
+        const uint64_t seq = sequence_of(state_.load(std::memory_order_relaxed)) + count;
+        state_.store((seq << kIndexBits) | published, std::memory_order_seq_cst);
+
+        // En fazla MaxSubscribers tampon sabitli olabilir: tarama her zaman serbest tampon bulur.
+        // En düşük indeksli serbest tampon seçilir; okuyucu yokken yazıcı iki tamponu dönüşümlü
+        // kullanır ve büyük mesajlarda bile tamponlar cache'te sıcak kalır.
+        for (uint32_t i = 0; i < kBuffers; ++i) {
+            if (i != published && buffers_[i].readers.load(std::memory_order_seq_cst) == 0) {
+                back_ = i;
+                break;
+            }
+        }
+        stats_.on_publish(count);
+        listeners_.notify();
+    }
+
+public:
+    // Publisher'ın mesajı doğrudan yazıcı tamponunda oluşturması için ödünç alma (zero-copy).
+    // Tampon okuyuculara görünmez; commit() edilmeden yok edilirse mesaj yayınlanmaz.
+    // Tampon önceki mesajlardan birini içerir, tüm alanlar yazılmalıdır.
+    class Loan {
+    public:
+        Loan(Loan&& other) noexcept : topic_(other.topic_) { other.topic_ = nullptr; }
+        Loan(const Loan&) = delete;
+        Loan& operator=(const Loan&) = delete;
+        Loan& operator=(Loan&&) = delete;
+        ~Loan() = default;
+
+        T& get() noexcept { return topic_->buffers_[topic_->back_].data; }
+        T& operator*() noexcept { return get(); }
+        T* operator->() noexcept { return &get(); }
+
+        void commit() noexcept {
+            if (!topic_) return;
+            topic_->commit(1);
+            topic_ = nullptr;
+        }
+
+    private:
+        friend class LatestTopic;
+        explicit Loan(LatestTopic* topic) : topic_(topic) {}
+        LatestTopic* topic_;
+    };
+
+    explicit LatestTopic(const mreq_metadata* metadata = nullptr) : metadata_(metadata) {}
+
+    void bind_metadata(const mreq_metadata* metadata) {
+        metadata_ = metadata;
+    }
+
+    const mreq_metadata* get_metadata() const {
+        return metadata_;
+    }
+
+    // Sadece tek bir yazıcı thread'inden çağrılmalıdır
+    Loan loan() noexcept {
+        return Loan(this);
+    }
+
+    // Sadece tek bir yazıcı thread'inden çağrılmalıdır
+    void publish(const T& msg) noexcept {
+        std::memcpy(&buffers_[back_].data, &msg, sizeof(T));
+        commit(1);
+    }
+
+    // Sadece son mesaj saklanır; sequence count kadar ilerler (öncekiler kaçırılmış sayılır)
+    void publish_multiple(const T* msgs, size_t count) noexcept {
+        if (count == 0) return;
+        std::memcpy(&buffers_[back_].data, &msgs[count - 1], sizeof(T));
+        commit(count);
+    }
+
+    std::optional<Token> subscribe() {
+        std::optional<Token> token_opt = subscribers_.subscribe();
+        if (token_opt.has_value()) {
+            stats_.on_subscribe(token_opt.value());
+            // Abone sadece abonelik sonrası yayınlanan mesajları okur
+            subscribers_.update_read_state(token_opt.value(), sequence(), 0);
+        }
+        return token_opt;
+    }
+
+    std::optional<T> read(Token token) const noexcept {
+        ReadInfo info;
+        return read(token, info);
+    }
+
+    // En güncel mesaj; info.dropped önceki okumadan bu yana atlanan mesaj sayısıdır
+    std::optional<T> read(Token token, ReadInfo& info) const noexcept {
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (!slot.active.load(std::memory_order_relaxed)) return std::nullopt;
+
+        const size_t last_read_seq = slot.last_read_seq.load(std::memory_order_relaxed);
+        uint64_t state = state_.load(std::memory_order_seq_cst);
+        if (sequence_of(state) <= last_read_seq) return std::nullopt;
+
+        state = pin(state);
+        const size_t seq = sequence_of(state);
+        T msg;
+        std::memcpy(&msg, &buffers_[index_of(state)].data, sizeof(T));
+        unpin(index_of(state));
+
+        slot.last_read_seq.store(seq, std::memory_order_relaxed);
+        info.sequence = seq;
+        info.dropped = seq - last_read_seq - 1;
+        stats_.on_read(token, 1, info.dropped);
+        return msg;
+    }
+
+    size_t read_multiple(Token token, T* out_buffer, size_t count) const noexcept {
+        ReadInfo info;
+        return read_multiple(token, out_buffer, count, info);
+    }
+
+    // En fazla bir mesaj (en güncel) okunur
+    size_t read_multiple(Token token, T* out_buffer, size_t count, ReadInfo& info) const noexcept {
+        info.dropped = 0;
+        if (count == 0) return 0;
+        std::optional<T> msg = read(token, info);
+        if (!msg) return 0;
+        out_buffer[0] = *msg;
+        return 1;
+    }
+
+    void unsubscribe(Token token) noexcept {
+        subscribers_.unsubscribe(token);
+    }
+
+    // Token etkin bir abonelik mi (unsubscribe edilmemiş)
+    bool subscribed(Token token) const noexcept {
+        return subscribers_.is_active(token);
+    }
+
+    bool check(Token token) const noexcept {
+        return subscribers_.check(token, sequence());
+    }
+
+    void stats(TopicStatsSnapshot& out) const noexcept {
+        out.topic_name = metadata_ ? metadata_->topic_name : nullptr;
+        internal::fill_subscriber_lag(subscribers_, sequence(), out);
+        stats_.fill(out);
+    }
+
+    bool attach_listener(const internal::TopicListener* listener) noexcept {
+        return listeners_.attach(listener);
+    }
+
+    void detach_listener(const internal::TopicListener* listener) noexcept {
+        listeners_.detach(listener);
+    }
+};
+
+}
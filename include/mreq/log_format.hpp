@@ -0,0 +1,162 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "mreq/metadata.hpp"
+
+namespace mreq {
+namespace log {
+
+// Kayıt/köprü çerçeve formatı (host byte order).
+// Dosya: FileHeader + art arda çerçeveler. Datagram: sadece art arda çerçeveler.
+// Çerçeve: FrameHeader + nanopb ile kodlanmış payload, 8 bayta hizalanır.
+// Ham çerçeve (kRawFrameMagic): payload = 8 baytlık ABI parmak izi + struct'ın kendisi (memcpy).
+// magic'i tutmayan ilk çerçeve (örn. önceden ayrılmış dosyanın sıfır kalan kısmı) akışın sonudur.
+
+constexpr uint32_t kFileMagic = 0x4C51524Du;   // "MRQL"
+constexpr uint32_t kFrameMagic = 0x4652514Du;  // "MQRF"
+constexpr uint32_t kRawFrameMagic = 0x5252514Du;  // "MQRR"
+constexpr uint16_t kFormatVersion = 1;
+
+struct FileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;       // Çerçevelerin başladığı offset
+    uint64_t created_ns;        // Kaydın başladığı an (mreq::now_ns)
+};
+
+struct FrameHeader {
+    uint32_t magic;
+    uint32_t length;            // Payload bayt sayısı (dolgu hariç)
+    uint64_t message_id;        // mreq_metadata::message_id
+    uint64_t sequence;          // Topic sequence numarası (ReadInfo::sequence)
+    uint64_t timestamp_ns;      // Kayıt anı (mreq::now_ns)
+};
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader yerleşimi sabit olmalı");
+static_assert(sizeof(FrameHeader) == 32, "FrameHeader yerleşimi sabit olmalı");
+
+constexpr size_t kFrameAlignment = 8;
+
+// Payload'ı length bayt olan bir çerçevenin toplam boyutu
+constexpr size_t frame_size(size_t length) noexcept {
+    return (sizeof(FrameHeader) + length + kFrameAlignment - 1) & ~(kFrameAlignment - 1);
+}
+
+inline FileHeader make_file_header(uint64_t created_ns) noexcept {
+    return {kFileMagic, kFormatVersion, static_cast<uint16_t>(sizeof(FileHeader)), created_ns};
+}
+
+// Dosya başlığını doğrular; çerçevelerin başladığı offset'i döndürür, geçersizse 0
+inline size_t parse_file_header(const void* data, size_t size) noexcept {
+    if (size < sizeof(FileHeader)) return 0;
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != kFileMagic || header.version != kFormatVersion ||
+        header.header_size < sizeof(FileHeader) || header.header_size > size) {
+        return 0;
+    }
+    return header.header_size;
+}
+
+enum class Encoding : uint8_t {
+    Nanopb,     // Taşınabilir: farklı ABI'li uçlar ve sürümler arası
+    Raw,        // Aynı ABI'li uçlar: tek memcpy (raw_capable() değilse Nanopb'ye düşer)
+};
+
+// Tipin en büyük çerçevesi; statik tampon/havuz boyutlamak için. 0: sınırsız veya bilinmiyor.
+template<typename T>
+constexpr size_t max_frame_size(Encoding encoding = Encoding::Nanopb) noexcept {
+    if (encoding == Encoding::Raw && raw_fingerprint<T>() != 0) {
+        return frame_size(sizeof(uint64_t) + sizeof(T));
+    }
+    return max_encoded_size<T>() != 0 ? frame_size(max_encoded_size<T>()) : 0;
+}
+
+// Çalışma zamanı eşdeğeri (metadata'nın max_encoded_size / abi_fingerprint alanlarından)
+constexpr size_t max_frame_size(const mreq_metadata& metadata, Encoding encoding = Encoding::Nanopb) noexcept {
+    if (encoding == Encoding::Raw && metadata.raw_capable()) {
+        return frame_size(sizeof(metadata.abi_fingerprint) + metadata.payload_size);
+    }
+    return metadata.max_encoded_size != 0 ? frame_size(metadata.max_encoded_size) : 0;
+}
+
+// Mesajı out'a çerçeve olarak kodlar (payload doğrudan hedefe yazılır, ara tampon yok).
+// Yazılan toplam bayt sayısını döndürür; yer yetmezse veya mesaj kodlanamıyorsa 0.
+inline size_t encode_frame(const mreq_metadata& metadata, const void* msg, uint64_t sequence,
+                           uint64_t timestamp_ns, void* out, size_t out_size,
+                           Encoding encoding = Encoding::Nanopb) noexcept {
+    if (out_size < sizeof(FrameHeader)) return 0;
+    uint8_t* dst = static_cast<uint8_t*>(out);
+    const bool raw = encoding == Encoding::Raw && metadata.raw_capable();
+    size_t length = 0;
+    if (raw) {
+        length = sizeof(metadata.abi_fingerprint) + metadata.payload_size;
+        if (frame_size(length) > out_size) return 0;
+        std::memcpy(dst + sizeof(FrameHeader), &metadata.abi_fingerprint, sizeof(metadata.abi_fingerprint));
+        std::memcpy(dst + sizeof(FrameHeader) + sizeof(metadata.abi_fingerprint), msg, metadata.payload_size);
+    } else if (!metadata.encode(msg, dst + sizeof(FrameHeader), out_size - sizeof(FrameHeader), &length)) {
+        return 0;
+    }
+    const size_t total = frame_size(length);
+    if (total > out_size) return 0;
+
+    const FrameHeader header{raw ? kRawFrameMagic : kFrameMagic, static_cast<uint32_t>(length),
+                             static_cast<uint64_t>(metadata.message_id), sequence, timestamp_ns};
+    std::memcpy(dst, &header, sizeof(header));
+    std::memset(dst + sizeof(FrameHeader) + length, 0, total - sizeof(FrameHeader) - length);
+    return total;
+}
+
+// Mesajın çerçeve boyutu (encode_frame() başarısızken yer yetmezliğini kodlama hatasından
+// ayırmak için); mesaj kodlanamıyorsa 0
+inline size_t encoded_frame_size(const mreq_metadata& metadata, const void* msg,
+                                 Encoding encoding = Encoding::Nanopb) noexcept {
+    if (encoding == Encoding::Raw && metadata.raw_capable()) {
+        return frame_size(sizeof(metadata.abi_fingerprint) + metadata.payload_size);
+    }
+    size_t length = 0;
+    if (!metadata.encoded_size(msg, &length)) return 0;
+    return frame_size(length);
+}
+
+// Ayrıştırılmış çerçeve; payload kaynak tampona işaret eder (kopya yok)
+struct Frame {
+    FrameHeader header{};
+    const uint8_t* payload = nullptr;
+};
+
+// data[offset..size) içindeki sıradaki çerçeveyi okur ve offset'i ilerletir.
+// Akış sonunda veya bozuk/kesik çerçevede false döner (offset değişmez).
+inline bool next_frame(const void* data, size_t size, size_t& offset, Frame& out) noexcept {
+    if (offset > size || size - offset < sizeof(FrameHeader)) return false;
+    const uint8_t* src = static_cast<const uint8_t*>(data) + offset;
+    std::memcpy(&out.header, src, sizeof(FrameHeader));
+    if (out.header.magic != kFrameMagic && out.header.magic != kRawFrameMagic) return false;
+
+    const size_t total = frame_size(out.header.length);
+    if (total > size - offset) return false;
+    out.payload = src + sizeof(FrameHeader);
+    offset += total;
+    return true;
+}
+
+// Çerçevenin payload'ını out'a (payload_size baytlık struct) çözer.
+// Ham çerçeveler sadece parmak izi metadata'nınkiyle aynıysa kopyalanır; aksi halde false.
+inline bool decode_frame(const mreq_metadata& metadata, const Frame& frame, void* out) noexcept {
+    if (frame.header.magic == kRawFrameMagic) {
+        uint64_t fingerprint = 0;
+        if (!metadata.raw_capable() ||
+            frame.header.length != sizeof(fingerprint) + metadata.payload_size) {
+            return false;
+        }
+        std::memcpy(&fingerprint, frame.payload, sizeof(fingerprint));
+        if (fingerprint != metadata.abi_fingerprint) return false;
+        std::memcpy(out, frame.payload + sizeof(fingerprint), metadata.payload_size);
+        return true;
+    }
+    return metadata.decode(frame.payload, frame.header.length, out);
+}
+
+} // namespace log
+} // namespace mreq
@@ -2,6 +2,10 @@
 
 #include <cstddef>
 #include <optional>
+#include "mreq/internal/TopicListeners.hpp"
+#include "mreq/raw_layout.hpp"
+#include "mreq/read_info.hpp"
+#include "mreq/topic_stats.hpp"
 #include "pb.h"
 #include "pb_encode.h"
 #include "pb_decode.h"
@@ -15,6 +19,19 @@ struct mreq_metadata;
 
 bool nanopb_encode_wrapper(const mreq_metadata& metadata, const void* data, void* buffer, size_t buffer_size, size_t* message_length);
 bool nanopb_decode_wrapper(const mreq_metadata& metadata, const void* buffer, size_t buffer_size, void* data);
+bool nanopb_encoded_size_wrapper(const mreq_metadata& metadata, const void* data, size_t* size);
+
+// Tipin nanopb ile kodlanmış en büyük boyutu (<Msg>_size); 0: sınırsız veya bilinmiyor.
+// MREQ_MAX_ENCODED_SIZE(type) ile tanımlanır.
+template<typename T>
+struct MaxEncodedSize {
+    static constexpr size_t value = 0;
+};
+
+template<typename T>
+constexpr size_t max_encoded_size() noexcept {
+    return MaxEncodedSize<T>::value;
+}
 
 struct mreq_metadata {
     const char* topic_name;        // Topic adı (örn: "sensor_accel")
@@ -32,6 +49,26 @@ struct mreq_metadata {
     // Type-safe read operations (template specialization needed)
     void* (*read_fn)(void* topic, Token token, void* result);  // Returns result ptr if success
     size_t (*read_multiple_fn)(void* topic, Token token, void* buffer, size_t count);
+
+    // Publish bildirimleri (WaitSet); desteklemeyen topic'lerde nullptr
+    bool (*attach_listener_fn)(void* topic, const internal::TopicListener* listener);
+    void (*detach_listener_fn)(void* topic, const internal::TopicListener* listener);
+
+    // Çalışma zamanı istatistikleri (MREQ_ENABLE_STATS)
+    void (*stats_fn)(void* topic, TopicStatsSnapshot* out);
+
+    // Sequence numarası ve kaçırılan mesaj sayısını da bildiren okumalar
+    void* (*read_info_fn)(void* topic, Token token, void* result, ReadInfo* info);
+    size_t (*read_multiple_info_fn)(void* topic, Token token, void* buffer, size_t count, ReadInfo* info);
+
+    // Burst yayınlama: tek çağrıda count mesaj
+    void (*publish_multiple_fn)(void* topic, const void* data, size_t count);
+
+    // Ham wire modu ABI parmak izi (mreq::RawLayout); 0: sadece nanopb ile taşınabilir
+    uint64_t abi_fingerprint = 0;
+
+    // En büyük kodlanmış boyut (mreq::MaxEncodedSize); 0: sınırsız veya bilinmiyor
+    size_t max_encoded_size = 0;
     
     // nanopb serialization/deserialization fonksiyonları
     bool encode(const void* data, void* buffer, size_t buffer_size, size_t* message_length) const {
@@ -41,6 +78,16 @@ struct mreq_metadata {
     bool decode(const void* buffer, size_t buffer_size, void* data) const {
         return nanopb_decode_wrapper(*this, buffer, buffer_size, data);
     }
+
+    // data'nın kodlanmış boyutu (pb_get_encoded_size); encode'dan önce tampon boyutlamak için
+    bool encoded_size(const void* data, size_t* size) const {
+        return nanopb_encoded_size_wrapper(*this, data, size);
+    }
+
+    // Aynı parmak izine sahip uçlar arasında payload_size bayt memcpy ile taşınabilir
+    constexpr bool raw_capable() const {
+        return abi_fingerprint != 0;
+    }
     
     // ULTRA-FAST topic operations via direct function calls
     inline std::optional<Token> subscribe() const {
@@ -58,6 +105,11 @@ struct mreq_metadata {
     inline void publish(const void* data) const {
         if (publish_fn) publish_fn(topic_instance, data);
     }
+
+    // data: payload_size boyutlu count mesajlık dizi
+    inline void publish_multiple(const void* data, size_t count) const {
+        if (publish_multiple_fn) publish_multiple_fn(topic_instance, data, count);
+    }
     
     // Type-safe read (caller must cast result)
     template<typename T>
@@ -74,6 +126,35 @@ struct mreq_metadata {
     inline size_t read_multiple(Token token, T* buffer, size_t count) const {
         return read_multiple_fn ? read_multiple_fn(topic_instance, token, buffer, count) : 0;
     }
+
+    inline bool attach_listener(const internal::TopicListener* listener) const {
+        return attach_listener_fn ? attach_listener_fn(topic_instance, listener) : false;
+    }
+
+    inline void detach_listener(const internal::TopicListener* listener) const {
+        if (detach_listener_fn) detach_listener_fn(topic_instance, listener);
+    }
+
+    inline bool stats(TopicStatsSnapshot& out) const {
+        if (!stats_fn) return false;
+        stats_fn(topic_instance, &out);
+        out.topic_name = topic_name;
+        return true;
+    }
+    
+    template<typename T>
+    inline std::optional<T> read(Token token, ReadInfo& info) const {
+        if (!read_info_fn) return std::nullopt;
+
+        T result;
+        void* ret = read_info_fn(topic_instance, token, &result, &info);
+        return ret ? std::make_optional(result) : std::nullopt;
+    }
+
+    template<typename T>
+    inline size_t read_multiple(Token token, T* buffer, size_t count, ReadInfo& info) const {
+        return read_multiple_info_fn ? read_multiple_info_fn(topic_instance, token, buffer, count, &info) : 0;
+    }
     
     // Metadata karşılaştırma için ID-based
     constexpr bool operator==(const mreq_metadata& other) const {
@@ -127,6 +208,12 @@ inline bool nanopb_decode_wrapper(const mreq_metadata& metadata, const void* buf
     return pb_decode(&stream, metadata.fields, data);
 }
 
+inline bool nanopb_encoded_size_wrapper(const mreq_metadata& metadata, const void* data, size_t* size) {
+    if (!metadata.fields) return false;
+
+    return pb_get_encoded_size(size, metadata.fields, data);
+}
+
 } // namespace mreq
 
 // Get metadata for runtime operations
@@ -135,25 +222,47 @@ inline bool nanopb_decode_wrapper(const mreq_metadata& metadata, const void* buf
 // Get compile-time message ID
 #define MREQ_GET_MESSAGE_ID(NAME) (__mreq_##NAME.message_id)
 
+// nanopb'nin <Msg>_size sabitini metadata'ya ve mreq::max_encoded_size<type>()'a bağlar.
+// .pb.h'dan sonra, global kapsamda yazılır; _size üretilmeyen (sınırsız alanlı) mesajlarda
+// kullanılmaz (kod üreteci #ifdef type##_size ile korur).
+#define MREQ_MAX_ENCODED_SIZE(type) \
+    template<> \
+    struct mreq::MaxEncodedSize<type> { \
+        static constexpr size_t value = type##_size; \
+    };
+
 // Metadata oluşturma makrosu
 #define MREQ_METADATA_DECLARE(name) \
     extern const mreq::mreq_metadata __mreq_##name;
 
-#define MREQ_NANOPB_METADATA_DEFINE(type, name, buffer_size) \
+// Herhangi bir topic sınıfı için metadata (örn: mreq::SeqlockTopic<type, 8>)
+// Topic tipi virgül içerebildiği için son (variadic) parametre olarak verilir.
+#define MREQ_NANOPB_METADATA_DEFINE_AS(type, name, ...) \
     const mreq::mreq_metadata __mreq_##name = { \
         #name, \
         sizeof(type), \
         mreq::constexpr_hash(#name), \
         type##_fields, \
         &name##_topic_instance, \
-        mreq::Topic<type, buffer_size>::static_subscribe, \
-        mreq::Topic<type, buffer_size>::static_unsubscribe, \
-        mreq::Topic<type, buffer_size>::static_check, \
-        mreq::Topic<type, buffer_size>::static_publish, \
-        mreq::Topic<type, buffer_size>::static_read, \
-        mreq::Topic<type, buffer_size>::static_read_multiple \
+        __VA_ARGS__::static_subscribe, \
+        __VA_ARGS__::static_unsubscribe, \
+        __VA_ARGS__::static_check, \
+        __VA_ARGS__::static_publish, \
+        __VA_ARGS__::static_read, \
+        __VA_ARGS__::static_read_multiple, \
+        __VA_ARGS__::static_attach_listener, \
+        __VA_ARGS__::static_detach_listener, \
+        __VA_ARGS__::static_stats, \
+        __VA_ARGS__::static_read_info, \
+        __VA_ARGS__::static_read_multiple_info, \
+        __VA_ARGS__::static_publish_multiple, \
+        mreq::raw_fingerprint<type>(), \
+        mreq::max_encoded_size<type>() \
     };
 
+#define MREQ_NANOPB_METADATA_DEFINE(type, name, buffer_size) \
+    MREQ_NANOPB_METADATA_DEFINE_AS(type, name, mreq::Topic<type, buffer_size>)
+
 #define MREQ_METADATA_DEFINE(type, name, buffer_size) \
     const mreq::mreq_metadata __mreq_##name = { \
         #name, \
@@ -166,5 +275,13 @@ inline bool nanopb_decode_wrapper(const mreq_metadata& metadata, const void* buf
         nullptr, \
         nullptr, \
         nullptr, \
-        nullptr \
-    };
\ No newline at end of file
+        nullptr, \
+        nullptr, \
+        nullptr, \
+        nullptr, \
+        nullptr, \
+        nullptr, \
+        nullptr, \
+        mreq::raw_fingerprint<type>(), \
+        mreq::max_encoded_size<type>() \
+    };
@@ -4,6 +4,10 @@
 #include <cassert>
 #include "metadata.hpp"
 #include "topic.hpp"
+#include "seqlock_topic.hpp"
+#include "multi_producer_topic.hpp"
+#include "latest_topic.hpp"
+#include "wait_set.hpp"
 
 #define MREQ_SUBSCRIBE(NAME) \
     MREQ_GET_METADATA(NAME)->subscribe_fn(MREQ_GET_METADATA(NAME)->topic_instance)
@@ -17,8 +21,9 @@
 #define MREQ_PUBLISH(NAME, DATA) \
     MREQ_GET_METADATA(NAME)->publish_fn(MREQ_GET_METADATA(NAME)->topic_instance, &(DATA))
 
+// Topic, tanımlandığı sınıfa (Topic, SeqlockTopic, MultiProducerTopic, LatestTopic, ShmTopic) çevrilir
 #define MREQ_READ(NAME, TOKEN) \
-    (static_cast<mreq::Topic<decltype(NAME##_topic_instance)::value_type, 1>*>(MREQ_GET_METADATA(NAME)->topic_instance))->read(TOKEN)
+    (static_cast<decltype(NAME##_topic_instance)*>(MREQ_GET_METADATA(NAME)->topic_instance))->read(TOKEN)
 
 #define MREQ_READ_MULTIPLE(NAME, TOKEN, BUFFER, COUNT) \
-    (static_cast<mreq::Topic<decltype(NAME##_topic_instance)::value_type, 1>*>(MREQ_GET_METADATA(NAME)->topic_instance))->read_multiple(TOKEN, BUFFER, COUNT)
+    (static_cast<decltype(NAME##_topic_instance)*>(MREQ_GET_METADATA(NAME)->topic_instance))->read_multiple(TOKEN, BUFFER, COUNT)
@@ -0,0 +1,149 @@
+#pragma once
+#include <optional>
+#include <cstdio> // For printf
+#include "subscriber_table.hpp"
+#include "mreq/internal/SequencedRing.hpp"
+#include "mreq/internal/TopicOps.hpp"
+#include "mreq/internal/TopicStats.hpp"
+
+using Token = size_t;
+
+namespace mreq {
+
+struct mreq_metadata;
+
+// Çok yazıcılı (multi-producer), kilitsiz topic.
+// Yazıcılar sequence numarasını atomik fetch-add ile talep eder ve mesajı slotun
+// commit sayacı ile yayınlar. Okuyucular sequence sırasıyla okur; henüz commit
+// edilmemiş bir mesajda durur, böylece her abone tutarlı ve sıralı bir akış görür.
+// Not: Bir yazıcı, N mesaj öncesinin yazıcısı commit edene kadar bekler. Tek çekirdekli,
+// öncelik tabanlı RTOS'larda öncelik terslenmesine yol açabileceği için Topic tercih edilmelidir.
+template<typename T, size_t N = 1, size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS>
+class MultiProducerTopic : public internal::TopicOps<MultiProducerTopic<T, N, MaxSubscribers>, T> {
+public:
+    using value_type = T;
+private:
+    internal::SequencedRing<T, N> ring_{};
+    mutable SubscriberTable<T, MaxSubscribers> subscribers_;
+    internal::TopicListeners listeners_;
+    mutable internal::TopicStats<MaxSubscribers> stats_;
+
+    // Metadata pointer for this topic instance
+    const mreq_metadata* metadata_ = nullptr;
+
+public:
+    explicit MultiProducerTopic(const mreq_metadata* metadata = nullptr) : metadata_(metadata) {}
+
+    void bind_metadata(const mreq_metadata* metadata) {
+        metadata_ = metadata;
+    }
+
+    const mreq_metadata* get_metadata() const {
+        return metadata_;
+    }
+
+    // Birden fazla thread'den eşzamanlı çağrılabilir
+    void publish(const T& msg) noexcept {
+        [[maybe_unused]] const size_t seq = ring_.publish(msg);
+        stats_.on_publish();
+        listeners_.notify();
+
+#ifdef MREQ_ENABLE_LOGGING
+        printf("MP_TOPIC[%s]: Published seq=%zu\n",
+               metadata_ ? metadata_->topic_name : "unknown", seq);
+#endif
+    }
+
+    // Tek bir atomik talep ile ardışık sequence numaraları alır; araya başka yazıcı girmez
+    void publish_multiple(const T* msgs, size_t count) noexcept {
+        if (count == 0) return;
+        ring_.publish_multiple(msgs, count);
+        stats_.on_publish(count);
+        listeners_.notify();
+    }
+
+    std::optional<Token> subscribe() {
+        std::optional<Token> token_opt = subscribers_.subscribe();
+        if (token_opt.has_value()) {
+            stats_.on_subscribe(token_opt.value());
+            // Abone sadece abonelik sonrası talep edilen mesajları okur
+            subscribers_.update_read_state(token_opt.value(), ring_.head(), 0);
+        }
+        return token_opt;
+    }
+
+    std::optional<T> read(Token token) const noexcept {
+        ReadInfo info;
+        return read(token, info);
+    }
+
+    // Mesajla birlikte sequence numarasını ve öncesinde kaçırılan mesaj sayısını döndürür
+    std::optional<T> read(Token token, ReadInfo& info) const noexcept {
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (!slot.active.load(std::memory_order_relaxed)) return std::nullopt;
+
+        const size_t before = slot.last_read_seq.load(std::memory_order_relaxed);
+        T msg;
+        if (ring_.try_read_next(slot.last_read_seq, msg)) {
+            info.sequence = slot.last_read_seq.load(std::memory_order_relaxed);
+            info.dropped = info.sequence - before - 1;
+            stats_.on_read(token, 1, info.dropped);
+            return msg;
+        }
+        return std::nullopt;
+    }
+
+    size_t read_multiple(Token token, T* out_buffer, size_t count) const noexcept {
+        ReadInfo info;
+        return read_multiple(token, out_buffer, count, info);
+    }
+
+    // info.sequence: son okunan mesaj, info.dropped: bu çağrıda atlanan toplam mesaj
+    size_t read_multiple(Token token, T* out_buffer, size_t count, ReadInfo& info) const noexcept {
+        info.dropped = 0;
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (!slot.active.load(std::memory_order_relaxed)) return 0;
+
+        const size_t before = slot.last_read_seq.load(std::memory_order_relaxed);
+        size_t messages_read = 0;
+        while (messages_read < count && ring_.try_read_next(slot.last_read_seq, out_buffer[messages_read])) {
+            ++messages_read;
+        }
+        const size_t after = slot.last_read_seq.load(std::memory_order_relaxed);
+        if (messages_read > 0) info.sequence = after;
+        info.dropped = after - before - messages_read;
+        stats_.on_read(token, messages_read, info.dropped);
+        return messages_read;
+    }
+
+    void unsubscribe(Token token) noexcept {
+        subscribers_.unsubscribe(token);
+    }
+
+    // Token etkin bir abonelik mi (unsubscribe edilmemiş)
+    bool subscribed(Token token) const noexcept {
+        return subscribers_.is_active(token);
+    }
+
+    // Wait-free: sıradaki mesajın slotunda tek bir acquire load
+    bool check(Token token) const noexcept {
+        const SubscriberSlot& slot = subscribers_.get_slot(token);
+        return slot.active.load(std::memory_order_relaxed) && ring_.has_next(slot.last_read_seq);
+    }
+
+    void stats(TopicStatsSnapshot& out) const noexcept {
+        out.topic_name = metadata_ ? metadata_->topic_name : nullptr;
+        internal::fill_subscriber_lag(subscribers_, ring_.head(), out);
+        stats_.fill(out);
+    }
+
+    bool attach_listener(const internal::TopicListener* listener) noexcept {
+        return listeners_.attach(listener);
+    }
+
+    void detach_listener(const internal::TopicListener* listener) noexcept {
+        listeners_.detach(listener);
+    }
+};
+
+}
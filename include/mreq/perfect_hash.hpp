@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mreq {
+
+// Derleme zamanında üretilen (scripts/generate_topic_registry.py) topic tablosu için
+// çarpımsal perfect hash. Sadece ID'nin alt 32 biti kullanılır; böylece 32 ve 64 bit
+// size_t'li hedeflerde aynı tablo geçerlidir. Python tarafındaki formül ile birebir aynıdır.
+constexpr size_t perfect_hash_slot(size_t message_id, uint32_t seed, unsigned shift) {
+    return static_cast<size_t>(
+        static_cast<uint64_t>(static_cast<uint32_t>(static_cast<uint32_t>(message_id) * seed)) >> shift);
+}
+
+// Derleme zamanı doğrulaması: ID listesinde (alt 32 bit dahil) çakışma yok mu?
+constexpr bool message_ids_unique(const size_t* ids, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = i + 1; j < count; ++j) {
+            if (static_cast<uint32_t>(ids[i]) == static_cast<uint32_t>(ids[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace mreq
@@ -0,0 +1,26 @@
+#include <cstdint>
+
+// Uygulama bir zaman kaynağı sağlayabilir: örn. -DMREQ_BAREMETAL_NOW_NS=board_time_ns()
+namespace mreq {
+
+// Zaman kaynağı yoksa now_ns() hep 0 döner; zamana dayalı seçenekler (throttle) reddedilir
+#ifdef MREQ_BAREMETAL_NOW_NS
+inline constexpr bool kHasClock = true;
+#else
+inline constexpr bool kHasClock = false;
+#endif
+
+inline uint64_t now_ns() {
+#ifdef MREQ_BAREMETAL_NOW_NS
+    return static_cast<uint64_t>(MREQ_BAREMETAL_NOW_NS);
+#else
+    return 0;
+#endif
+}
+
+// Sanal saat yok: zaman aşımları için de aynı saat
+inline uint64_t monotonic_ns() {
+    return now_ns();
+}
+
+} // namespace mreq
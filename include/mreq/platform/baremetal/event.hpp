@@ -0,0 +1,15 @@
+#include "mreq/internal/NonCopyable.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace mreq {
+
+// Zamanlayıcı yok: wait_for() bloklamaz, sadece bekleyen sinyali tüketir
+struct Event : private internal::NonCopyable {
+    void notify() { signaled.store(true, std::memory_order_release); }
+    bool wait_for(uint32_t) { return signaled.exchange(false, std::memory_order_acquire); }
+private:
+    std::atomic<bool> signaled{false};
+};
+
+} // namespace mreq
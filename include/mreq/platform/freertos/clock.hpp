@@ -0,0 +1,19 @@
+#include "freertos/FreeRTOS.h" // For FreeRTOS types and macros
+#include "freertos/task.h"
+#include <cstdint>
+
+namespace mreq {
+
+inline constexpr bool kHasClock = true;
+
+// Tick çözünürlüğünde monoton saat (nanosaniye)
+inline uint64_t now_ns() {
+    return static_cast<uint64_t>(xTaskGetTickCount()) * portTICK_PERIOD_MS * 1000000ull;
+}
+
+// Sanal saat yok: zaman aşımları için de aynı saat
+inline uint64_t monotonic_ns() {
+    return now_ns();
+}
+
+} // namespace mreq
@@ -0,0 +1,29 @@
+#include "mreq/internal/NonCopyable.hpp"
+#include "freertos/FreeRTOS.h" // For FreeRTOS types and macros
+#include "freertos/semphr.h"
+#include <cstdint>
+
+namespace mreq {
+
+// Otomatik sıfırlanan olay (binary semaphore)
+class Event : private internal::NonCopyable {
+public:
+    Event() { handle = xSemaphoreCreateBinary(); }
+    ~Event() {
+        if (handle) {
+            vSemaphoreDelete(handle);
+            handle = nullptr;
+        }
+    }
+
+    void notify() { xSemaphoreGive(handle); }
+
+    // Sinyal gelirse true, zaman aşımında false döner
+    bool wait_for(uint32_t timeout_ms) {
+        return xSemaphoreTake(handle, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+    }
+private:
+    SemaphoreHandle_t handle = nullptr;
+};
+
+} // namespace mreq
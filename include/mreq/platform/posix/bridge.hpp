@@ -0,0 +1,360 @@
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "mreq/clock.hpp"
+#include "mreq/log_format.hpp"
+#include "mreq/metadata.hpp"
+#include "mreq/topic_registry.hpp"
+#include "mreq/internal/NonCopyable.hpp"
+
+// Bir köprünün iletebileceği en fazla topic
+#ifndef MREQ_BRIDGE_MAX_TOPICS
+#define MREQ_BRIDGE_MAX_TOPICS 16
+#endif
+
+// Gelen message_id -> yerel topic yönlendirmesi sayısı
+#ifndef MREQ_BRIDGE_MAX_ROUTES
+#define MREQ_BRIDGE_MAX_ROUTES 16
+#endif
+
+// İletilebilecek en büyük mesaj struct'ı
+#ifndef MREQ_BRIDGE_MAX_PAYLOAD
+#define MREQ_BRIDGE_MAX_PAYLOAD 1024
+#endif
+
+// Datagram boyutu: varsayılan 1500 MTU'da parçalanmayan en büyük IPv4 UDP payload'ı
+#ifndef MREQ_BRIDGE_DATAGRAM_SIZE
+#define MREQ_BRIDGE_DATAGRAM_SIZE 1472
+#endif
+
+// Tek sendmmsg/recvmmsg çağrısındaki datagram sayısı
+#ifndef MREQ_BRIDGE_BATCH
+#define MREQ_BRIDGE_BATCH 32
+#endif
+
+namespace mreq {
+
+// Topic'leri süreç dışına taşıyan UDP / Unix datagram köprüsü.
+// send(): eklenen topic'lerin okunmamış mesajlarını nanopb ile (set_encoding(Raw) ise
+// raw_capable() topic'lerde memcpy ile) log_format çerçevelerine kodlar,
+// her datagrama sığdığı kadar çerçeve koyar ve datagramları tek sendmmsg ile gönderir.
+// receive(): recvmmsg ile gelen datagramlardaki çerçeveleri message_id ile (önce route(),
+// sonra registry) yerel topic'e çözer ve publish eder. Ham çerçeveler sadece ABI parmak izi
+// yerel topic'inkiyle aynıysa kabul edilir; değilse errors() sayılır. Bu köprünün ilettiği topic'lere gelen
+// çerçeveler yankı döngüsü oluşmasın diye yayınlanmaz.
+// Soket bloklamaz; köprü sıradan bir abonedir, publisher'ları beklemez. Tek thread'den kullanılır.
+class SocketBridge : private internal::NonCopyable {
+    struct Entry {
+        const mreq_metadata* metadata = nullptr;
+        Token token = 0;
+    };
+
+    struct Route {
+        size_t remote_id = 0;
+        const mreq_metadata* local = nullptr;
+    };
+
+    struct Datagram {
+        alignas(8) uint8_t data[MREQ_BRIDGE_DATAGRAM_SIZE];
+    };
+
+    int fd_ = -1;
+    sockaddr_storage peer_{};
+    socklen_t peer_len_ = 0;
+    char unix_path_[sizeof(sockaddr_un::sun_path)] = {};
+
+    Entry entries_[MREQ_BRIDGE_MAX_TOPICS];
+    size_t entry_count_ = 0;
+    Route routes_[MREQ_BRIDGE_MAX_ROUTES];
+    size_t route_count_ = 0;
+    log::Encoding encoding_ = log::Encoding::Nanopb;
+
+    alignas(std::max_align_t) uint8_t scratch_[MREQ_BRIDGE_MAX_PAYLOAD];
+    Datagram tx_[MREQ_BRIDGE_BATCH];
+    size_t tx_size_[MREQ_BRIDGE_BATCH] = {};
+    size_t tx_frames_[MREQ_BRIDGE_BATCH] = {};   // Datagram başına çerçeve sayısı
+    size_t tx_count_ = 0;       // Dolu datagram sayısı (= doldurulan datagramın indeksi)
+    Datagram rx_[MREQ_BRIDGE_BATCH];
+    iovec iov_[MREQ_BRIDGE_BATCH];
+    mmsghdr msgs_[MREQ_BRIDGE_BATCH];
+
+    uint64_t frames_sent_ = 0;
+    uint64_t datagrams_sent_ = 0;
+    uint64_t frames_received_ = 0;
+    uint64_t dropped_ = 0;
+    uint64_t lost_ = 0;
+    uint64_t errors_ = 0;
+
+    bool finish_open(int fd) noexcept {
+        if (fd < 0) return false;
+        fd_ = fd;
+        return true;
+    }
+
+    // Sıradaki datagramı boşaltır
+    void reset_datagram() noexcept {
+        tx_size_[tx_count_] = 0;
+        tx_frames_[tx_count_] = 0;
+    }
+
+    // Bekleyen datagramları gönderir; gönderilemeyenler (soket tamponu dolu) düşürülür.
+    // Çerçeveler ancak datagramları gönderilince frames_sent()'e sayılır.
+    void flush() noexcept {
+        size_t sent = 0;
+        while (sent < tx_count_) {
+            const size_t batch = tx_count_ - sent;
+            for (size_t i = 0; i < batch; ++i) {
+                iov_[i] = {tx_[sent + i].data, tx_size_[sent + i]};
+                msgs_[i] = {};
+                msgs_[i].msg_hdr.msg_iov = &iov_[i];
+                msgs_[i].msg_hdr.msg_iovlen = 1;
+                msgs_[i].msg_hdr.msg_name = &peer_;
+                msgs_[i].msg_hdr.msg_namelen = peer_len_;
+            }
+            const int n = sendmmsg(fd_, msgs_, static_cast<unsigned>(batch), MSG_DONTWAIT);
+            if (n <= 0) {
+                if (n < 0 && errno == EINTR) continue;
+                break;
+            }
+            for (size_t i = sent; i < sent + static_cast<size_t>(n); ++i) frames_sent_ += tx_frames_[i];
+            sent += static_cast<size_t>(n);
+            datagrams_sent_ += static_cast<size_t>(n);
+        }
+        for (size_t i = sent; i < tx_count_; ++i) {
+            ++errors_;
+            lost_ += tx_frames_[i];
+        }
+        tx_count_ = 0;
+    }
+
+    // Mesajı geçerli datagrama kodlar; sığmazsa sıradaki datagrama geçer (grup dolunca gönderir)
+    void enqueue(const mreq_metadata& metadata, const void* msg, const ReadInfo& info) noexcept {
+        const uint64_t timestamp = now_ns();
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            size_t& used = tx_size_[tx_count_];
+            const size_t written = log::encode_frame(metadata, msg, info.sequence, timestamp,
+                                                     tx_[tx_count_].data + used,
+                                                     MREQ_BRIDGE_DATAGRAM_SIZE - used, encoding_);
+            if (written > 0) {
+                used += written;
+                ++tx_frames_[tx_count_];
+                return;
+            }
+            if (used == 0) break;           // Boş datagrama da sığmıyor
+            if (++tx_count_ == MREQ_BRIDGE_BATCH) flush();
+            reset_datagram();
+        }
+        ++errors_;
+        ++lost_;
+    }
+
+    bool forwards(size_t message_id) const noexcept {
+        for (size_t i = 0; i < entry_count_; ++i) {
+            if (entries_[i].metadata->message_id == message_id) return true;
+        }
+        return false;
+    }
+
+    const mreq_metadata* resolve(size_t message_id) const noexcept {
+        for (size_t i = 0; i < route_count_; ++i) {
+            if (routes_[i].remote_id == message_id) return routes_[i].local;
+        }
+        return forwards(message_id) ? nullptr : TopicRegistry::instance().find_by_id(message_id);
+    }
+
+    void deliver(const uint8_t* data, size_t size) noexcept {
+        size_t offset = 0;
+        log::Frame frame{};
+        while (log::next_frame(data, size, offset, frame)) {
+            const mreq_metadata* metadata = resolve(static_cast<size_t>(frame.header.message_id));
+            if (!metadata || !metadata->publish_fn) {
+                ++dropped_;
+                continue;
+            }
+            if (metadata->payload_size > sizeof(scratch_) ||
+                !log::decode_frame(*metadata, frame, scratch_)) {
+                ++errors_;
+                continue;
+            }
+            metadata->publish(scratch_);
+            ++frames_received_;
+        }
+    }
+
+public:
+    SocketBridge() = default;
+    ~SocketBridge() { close(); }
+
+    // UDP: bind_ip:bind_port'a bağlanır (port 0: sistem seçer), peer_ip:peer_port'a gönderir.
+    // Sadece alan köprüde peer_ip nullptr olabilir.
+    bool open_udp(const char* bind_ip, uint16_t bind_port,
+                  const char* peer_ip = nullptr, uint16_t peer_port = 0) noexcept {
+        if (fd_ >= 0) return false;
+        sockaddr_in local{};
+        local.sin_family = AF_INET;
+        local.sin_port = htons(bind_port);
+        if (inet_pton(AF_INET, bind_ip ? bind_ip : "0.0.0.0", &local.sin_addr) != 1) return false;
+
+        if (peer_ip) {
+            sockaddr_in peer{};
+            peer.sin_family = AF_INET;
+            peer.sin_port = htons(peer_port);
+            if (inet_pton(AF_INET, peer_ip, &peer.sin_addr) != 1) return false;
+            std::memcpy(&peer_, &peer, sizeof(peer));
+            peer_len_ = sizeof(peer);
+        }
+
+        int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+            ::close(fd);
+            fd = -1;
+        }
+        return finish_open(fd);
+    }
+
+    // Unix datagram soketi: bind_path'e bağlanır (varsa eski soket dosyası silinir), peer_path'e gönderir
+    bool open_unix(const char* bind_path, const char* peer_path = nullptr) noexcept {
+        if (fd_ >= 0 || !bind_path || std::strlen(bind_path) >= sizeof(unix_path_)) return false;
+        sockaddr_un local{};
+        local.sun_family = AF_UNIX;
+        std::memcpy(local.sun_path, bind_path, std::strlen(bind_path) + 1);
+
+        if (peer_path) {
+            if (std::strlen(peer_path) >= sizeof(sockaddr_un::sun_path)) return false;
+            sockaddr_un peer{};
+            peer.sun_family = AF_UNIX;
+            std::memcpy(peer.sun_path, peer_path, std::strlen(peer_path) + 1);
+            std::memcpy(&peer_, &peer, sizeof(peer));
+            peer_len_ = sizeof(peer);
+        }
+
+        ::unlink(bind_path);
+        int fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+            ::close(fd);
+            fd = -1;
+        }
+        if (fd >= 0) std::memcpy(unix_path_, bind_path, std::strlen(bind_path) + 1);
+        return finish_open(fd);
+    }
+
+    void close() noexcept {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        if (unix_path_[0]) {
+            ::unlink(unix_path_);
+            unix_path_[0] = '\0';
+        }
+        for (size_t i = 0; i < entry_count_; ++i) {
+            entries_[i].metadata->unsubscribe(entries_[i].token);
+        }
+        entry_count_ = 0;
+        peer_len_ = 0;
+    }
+
+    bool is_open() const noexcept { return fd_ >= 0; }
+
+    // UDP soketinin bağlandığı port (bind_port 0 ise sistemin seçtiği)
+    uint16_t local_port() const noexcept {
+        sockaddr_in local{};
+        socklen_t len = sizeof(local);
+        if (fd_ < 0 || getsockname(fd_, reinterpret_cast<sockaddr*>(&local), &len) != 0 ||
+            local.sin_family != AF_INET) {
+            return 0;
+        }
+        return ntohs(local.sin_port);
+    }
+
+    // Gönderim kodlaması. Raw sadece karşı uç aynı ABI ile derlendiyse seçilmelidir; alan
+    // taraf her iki kodlamayı da kabul eder.
+    void set_encoding(log::Encoding encoding) noexcept { encoding_ = encoding; }
+
+    // Topic'i iletilecekler listesine ekler (abone olur)
+    bool add(const mreq_metadata* metadata) {
+        if (!metadata || (!metadata->fields && !metadata->raw_capable()) || !metadata->read_info_fn ||
+            metadata->payload_size > sizeof(scratch_) || entry_count_ == MREQ_BRIDGE_MAX_TOPICS) {
+            return false;
+        }
+        std::optional<Token> token = metadata->subscribe();
+        if (!token) return false;
+        entries_[entry_count_++] = {metadata, token.value()};
+        return true;
+    }
+
+    bool add(size_t message_id) {
+        return add(TopicRegistry::instance().find_by_id(message_id));
+    }
+
+    // Uzaktaki remote_id topic'inin çerçevelerini registry yerine local topic'e yayınlar
+    bool route(size_t remote_id, const mreq_metadata* local) noexcept {
+        if (!local || route_count_ == MREQ_BRIDGE_MAX_ROUTES) return false;
+        routes_[route_count_++] = {remote_id, local};
+        return true;
+    }
+
+    // Okunmamış mesajları gönderir; gönderilen datagramlardaki çerçeve sayısını döndürür
+    size_t send() noexcept {
+        if (fd_ < 0 || peer_len_ == 0) return 0;
+        const uint64_t before = frames_sent_;
+        tx_count_ = 0;
+        reset_datagram();
+        for (size_t i = 0; i < entry_count_; ++i) {
+            const Entry& entry = entries_[i];
+            ReadInfo info;
+            while (entry.metadata->read_info_fn(entry.metadata->topic_instance, entry.token, scratch_, &info)) {
+                lost_ += info.dropped;
+                enqueue(*entry.metadata, scratch_, info);
+            }
+        }
+        if (tx_size_[tx_count_] > 0) ++tx_count_;
+        flush();
+        return static_cast<size_t>(frames_sent_ - before);
+    }
+
+    // Bekleyen datagramları okur ve yayınlar; yayınlanan mesaj sayısını döndürür. Bloklamaz.
+    size_t receive() noexcept {
+        if (fd_ < 0) return 0;
+        const uint64_t before = frames_received_;
+        for (;;) {
+            for (size_t i = 0; i < MREQ_BRIDGE_BATCH; ++i) {
+                iov_[i] = {rx_[i].data, MREQ_BRIDGE_DATAGRAM_SIZE};
+                msgs_[i] = {};
+                msgs_[i].msg_hdr.msg_iov = &iov_[i];
+                msgs_[i].msg_hdr.msg_iovlen = 1;
+            }
+            const int n = recvmmsg(fd_, msgs_, MREQ_BRIDGE_BATCH, MSG_DONTWAIT, nullptr);
+            if (n <= 0) {
+                if (n < 0 && errno == EINTR) continue;
+                break;
+            }
+            for (int i = 0; i < n; ++i) {
+                deliver(rx_[i].data, msgs_[i].msg_len);
+            }
+            if (static_cast<size_t>(n) < MREQ_BRIDGE_BATCH) break;
+        }
+        return static_cast<size_t>(frames_received_ - before);
+    }
+
+    uint64_t frames_sent() const noexcept { return frames_sent_; }
+    uint64_t datagrams_sent() const noexcept { return datagrams_sent_; }
+    uint64_t frames_received() const noexcept { return frames_received_; }
+    // Yerel karşılığı olmayan (veya bu köprünün ilettiği topic'e ait) gelen çerçeveler
+    uint64_t dropped() const noexcept { return dropped_; }
+    // Gönderilemeden kaybolan mesajlar: köprü okuyamadan ring'in üzerine yazdıkları
+    // (recorder'daki dropped() gibi), kodlanamayanlar ve gönderilemeyen datagramlardaki çerçeveler
+    uint64_t lost() const noexcept { return lost_; }
+    // Kodlanamayan/çözülemeyen mesajlar ve gönderilemeyen datagramlar
+    uint64_t errors() const noexcept { return errors_; }
+};
+
+} // namespace mreq
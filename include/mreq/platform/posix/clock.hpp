@@ -0,0 +1,30 @@
+#include <time.h>
+#include <atomic>
+#include <cstdint>
+
+namespace mreq {
+
+inline constexpr bool kHasClock = true;
+
+namespace internal {
+// Sanal saat kaynağı (AsFastAsPossible Replayer); nullptr ise now_ns() monoton saattir
+inline std::atomic<const std::atomic<uint64_t>*> virtual_clock{nullptr};
+} // namespace internal
+
+// Gerçek monoton saat (nanosaniye): zaman aşımları ve bekleme ölçümleri içindir
+inline uint64_t monotonic_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// Uygulama saati (nanosaniye): throttle, kayıt ve istatistik zaman damgaları. Kayıt
+// oynatılırken Replayer'ın sanal saatini, aksi halde monoton saati döndürür.
+inline uint64_t now_ns() {
+    if (const std::atomic<uint64_t>* clock = internal::virtual_clock.load(std::memory_order_acquire)) {
+        return clock->load(std::memory_order_relaxed);
+    }
+    return monotonic_ns();
+}
+
+} // namespace mreq
@@ -0,0 +1,57 @@
+#include "mreq/internal/NonCopyable.hpp"
+#include <pthread.h>
+#include <time.h>
+#include <cstdint>
+
+namespace mreq {
+
+// Otomatik sıfırlanan olay: notify() bekleyen tek bir wait_for() çağrısını uyandırır
+class Event : private internal::NonCopyable {
+public:
+    Event() {
+        pthread_condattr_t attr;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&cond, &attr);
+        pthread_condattr_destroy(&attr);
+        pthread_mutex_init(&mtx, nullptr);
+    }
+    ~Event() {
+        pthread_cond_destroy(&cond);
+        pthread_mutex_destroy(&mtx);
+    }
+
+    void notify() {
+        pthread_mutex_lock(&mtx);
+        signaled = true;
+        pthread_cond_signal(&cond);
+        pthread_mutex_unlock(&mtx);
+    }
+
+    // Sinyal gelirse true, zaman aşımında false döner
+    bool wait_for(uint32_t timeout_ms) {
+        timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += static_cast<long>(timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        pthread_mutex_lock(&mtx);
+        while (!signaled) {
+            if (pthread_cond_timedwait(&cond, &mtx, &deadline) != 0) break;
+        }
+        const bool result = signaled;
+        signaled = false;
+        pthread_mutex_unlock(&mtx);
+        return result;
+    }
+private:
+    pthread_mutex_t mtx;
+    pthread_cond_t cond;
+    bool signaled = false;
+};
+
+} // namespace mreq
@@ -1,19 +1,145 @@
+#pragma once
 #include "mreq/internal/NonCopyable.hpp"
+#include "mreq/internal/Backoff.hpp"
+#include <atomic>
+#include <cstdint>
 #include <pthread.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// AdaptiveMutex'in uyumadan önce kilidi serbest bulmak için döneceği en fazla tur
+#ifndef MREQ_MUTEX_SPIN_COUNT
+#define MREQ_MUTEX_SPIN_COUNT 100
+#endif
 
 namespace mreq {
 
-class Mutex : private internal::NonCopyable {
+// Varsayılan öznitelikli pthread mutex'i. protocol: PTHREAD_PRIO_NONE / PTHREAD_PRIO_INHERIT
+class PthreadMutex : private internal::NonCopyable {
 public:
-    Mutex()  { pthread_mutex_init(&mtx, nullptr); }
-    ~Mutex() { destroy(); }
+    PthreadMutex() : PthreadMutex(PTHREAD_PRIO_NONE) {}
+    ~PthreadMutex() { destroy(); }
 
     void lock()   { pthread_mutex_lock(&mtx); }
     void unlock() { pthread_mutex_unlock(&mtx); }
     bool try_lock() { return pthread_mutex_trylock(&mtx) == 0; }
     void destroy()  { pthread_mutex_destroy(&mtx); }
+
+    // İstenen protokol platformca desteklenmediyse varsayılan özniteliklere dönülür
+    bool priority_inheritance() const { return prio_inherit; }
+
+protected:
+    explicit PthreadMutex(int protocol) {
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        if (protocol != PTHREAD_PRIO_NONE) {
+            prio_inherit = pthread_mutexattr_setprotocol(&attr, protocol) == 0;
+        }
+        if (pthread_mutex_init(&mtx, &attr) != 0 && prio_inherit) {
+            prio_inherit = false;
+            pthread_mutex_init(&mtx, nullptr);
+        }
+        pthread_mutexattr_destroy(&attr);
+    }
+
 private:
     pthread_mutex_t mtx;
+    bool prio_inherit = false;
+};
+
+// Öncelik kalıtımlı mutex: kilidi tutan düşük öncelikli thread, bekleyen en yüksek
+// öncelikli thread'in önceliğine yükseltilir (karışık öncelikli real-time thread'ler).
+class PriorityInheritMutex : public PthreadMutex {
+public:
+    PriorityInheritMutex() : PthreadMutex(PTHREAD_PRIO_INHERIT) {}
+};
+
+// Kısa kritik bölgeler için önce sınırlı dönüp sonra uyuyan kilit.
+// Kilit tutucusu başka bir çekirdekte çalışırken birkaç yüz ns içinde bırakacağından
+// MREQ_MUTEX_SPIN_COUNT tur boyunca syscall yapmadan beklenir; kilit hâlâ alınamazsa
+// Linux'ta doğrudan futex ile uyunur (durum: 0 serbest, 1 kilitli, 2 kilitli + bekleyen var).
+// unlock() sadece bekleyen varsa syscall yapar. Öncelik kalıtımı yoktur.
+class AdaptiveMutex : private internal::NonCopyable {
+public:
+    AdaptiveMutex() = default;
+
+    void lock() {
+        if (try_lock()) return;
+        for (uint32_t i = 0; i < MREQ_MUTEX_SPIN_COUNT; ++i) {
+            internal::cpu_relax();
+            // Bekleyen varken dönmek sıraya girenleri geçmek olur: doğrudan uyu
+            const uint32_t s = state_.load(std::memory_order_relaxed);
+            if (s == kWaiters) break;
+            if (s == kFree && try_lock()) return;
+        }
+        lock_slow();
+    }
+
+    void unlock() {
+        if (state_.exchange(kFree, std::memory_order_release) == kWaiters) {
+            wake();
+        }
+    }
+
+    bool try_lock() {
+        uint32_t expected = kFree;
+        return state_.compare_exchange_strong(expected, kLocked, std::memory_order_acquire,
+                                              std::memory_order_relaxed);
+    }
+
+    void destroy() {}
+
+private:
+    static constexpr uint32_t kFree = 0;
+    static constexpr uint32_t kLocked = 1;
+    static constexpr uint32_t kWaiters = 2;
+
+    std::atomic<uint32_t> state_{kFree};
+
+    // Kilidi "bekleyen var" olarak alana kadar uyur; unlock() bu durumda uyandırır
+    void lock_slow() {
+        while (state_.exchange(kWaiters, std::memory_order_acquire) != kFree) {
+            wait(kWaiters);
+        }
+    }
+
+#if defined(__linux__)
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex kelimesi 32 bit olmalı");
+
+    uint32_t* word() { return reinterpret_cast<uint32_t*>(&state_); }
+
+    // state_ hâlâ expected ise uyur; erken uyanmalar lock_slow() döngüsünde yeniden denenir
+    void wait(uint32_t expected) {
+        syscall(SYS_futex, word(), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+    }
+
+    void wake() {
+        syscall(SYS_futex, word(), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+#else
+    // futex olmayan POSIX sistemlerde (macOS) bekleyen CPU'yu bırakarak tekrar dener
+    void wait(uint32_t) {
+        internal::Backoff backoff;
+        while (state_.load(std::memory_order_relaxed) != kFree) {
+            backoff.pause();
+        }
+    }
+
+    void wake() {}
+#endif
 };
 
-} // namespace mreq 
+// Tüm topic'lerin (ve registry'nin) varsayılan kilidi; CMake MREQ_POSIX_MUTEX ile seçilir.
+// Tek bir topic için Topic<T, N, MaxSubscribers, MutexT> ile ayrıca seçilebilir.
+#if defined(MREQ_POSIX_MUTEX_ADAPTIVE)
+using Mutex = AdaptiveMutex;
+#elif defined(MREQ_POSIX_MUTEX_PRIO_INHERIT)
+using Mutex = PriorityInheritMutex;
+#else
+using Mutex = PthreadMutex;
+#endif
+
+} // namespace mreq
@@ -0,0 +1,244 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "mreq/clock.hpp"
+#include "mreq/log_format.hpp"
+#include "mreq/metadata.hpp"
+#include "mreq/topic_registry.hpp"
+#include "mreq/wait_set.hpp"
+#include "mreq/internal/NonCopyable.hpp"
+
+// Bir recorder'ın kaydedebileceği en fazla topic
+#ifndef MREQ_RECORDER_MAX_TOPICS
+#define MREQ_RECORDER_MAX_TOPICS 16
+#endif
+
+// Kaydedilebilecek en büyük mesaj struct'ı (okuma için önceden ayrılmış tampon)
+#ifndef MREQ_RECORDER_MAX_PAYLOAD
+#define MREQ_RECORDER_MAX_PAYLOAD 1024
+#endif
+
+namespace mreq {
+
+struct RecorderConfig {
+    const char* path = "mreq_log";          // Dosyalar: <path>.0, <path>.1, ...
+    size_t file_size = 64u * 1024u * 1024u; // Her dosya için önceden ayrılan boyut
+    size_t max_files = 0;                   // Diskte tutulacak en fazla dosya (0: sınırsız)
+    // Raw: raw_capable() topic'ler memcpy ile yazılır; kayıt sadece aynı ABI'de oynatılabilir
+    log::Encoding encoding = log::Encoding::Nanopb;
+};
+
+// Uçuş kaydedici: seçili topic'lerin her mesajını mmap'lenmiş, önceden ayrılmış dosyalara
+// log_format.hpp çerçeveleri olarak yazar. Recorder sıradan bir abonedir: publisher'lar onu
+// beklemez; geride kalırsa ring'in üzerine yazdığı mesajlar dropped() ile sayılır.
+// Dosya dolunca sıradaki dosyaya geçilir (rotation); max_files aşılırsa en eskisi silinir.
+// Payload nanopb `fields` ile (ya da ham modda memcpy ile) doğrudan eşlenmiş dosyaya yazılır;
+// heap ayrımı yapılmaz.
+// add()/open() start()'tan önce çağrılmalıdır; start() edilmediyse poll() sahip thread'den çağrılır.
+class Recorder : private internal::NonCopyable {
+    struct Entry {
+        const mreq_metadata* metadata = nullptr;
+        Token token = 0;
+    };
+
+    RecorderConfig config_{};
+    char path_[256] = {};
+    Entry entries_[MREQ_RECORDER_MAX_TOPICS];
+    size_t entry_count_ = 0;
+    alignas(std::max_align_t) uint8_t scratch_[MREQ_RECORDER_MAX_PAYLOAD];
+
+    int fd_ = -1;
+    uint8_t* map_ = nullptr;
+    size_t offset_ = 0;
+    size_t file_index_ = 0;
+
+    WaitSet wait_set_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+
+    std::atomic<uint64_t> frames_{0};
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> errors_{0};
+
+    void file_name(size_t index, char* out, size_t out_size) const noexcept {
+        snprintf(out, out_size, "%s.%zu", path_, index);
+    }
+
+    bool open_file(size_t index) noexcept {
+        char name[300];
+        file_name(index, name, sizeof(name));
+        int fd = ::open(name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+        if (ftruncate(fd, static_cast<off_t>(config_.file_size)) != 0) {
+            ::close(fd);
+            return false;
+        }
+        void* mem = mmap(nullptr, config_.file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mem == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+
+        fd_ = fd;
+        map_ = static_cast<uint8_t*>(mem);
+        file_index_ = index;
+        const log::FileHeader header = log::make_file_header(now_ns());
+        std::memcpy(map_, &header, sizeof(header));
+        offset_ = sizeof(header);
+
+        if (config_.max_files > 0 && index >= config_.max_files) {
+            file_name(index - config_.max_files, name, sizeof(name));
+            ::unlink(name);
+        }
+        return true;
+    }
+
+    // Eşlemeyi kaldırır ve dosyayı yazılan boyuta kırpar
+    void close_file() noexcept {
+        if (map_) {
+            munmap(map_, config_.file_size);
+            map_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            if (ftruncate(fd_, static_cast<off_t>(offset_)) != 0) {
+                errors_.fetch_add(1, std::memory_order_relaxed);
+            }
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    void write_frame(const mreq_metadata& metadata, const void* msg, const ReadInfo& info) noexcept {
+        const uint64_t timestamp = now_ns();
+        size_t written = log::encode_frame(metadata, msg, info.sequence, timestamp,
+                                           map_ + offset_, config_.file_size - offset_, config_.encoding);
+        if (written == 0) {
+            // Sadece kalan yere sığmayan çerçeve için dosya değiştirilir; kodlanamayan ya da
+            // boş dosyaya da sığmayan mesaj rotation yapmadan hata sayılır
+            const size_t needed = log::encoded_frame_size(metadata, msg, config_.encoding);
+            if (needed == 0 || needed <= config_.file_size - offset_ ||
+                needed > config_.file_size - sizeof(log::FileHeader)) {
+                errors_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            close_file();
+            if (!open_file(file_index_ + 1)) {
+                errors_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            written = log::encode_frame(metadata, msg, info.sequence, timestamp,
+                                        map_ + offset_, config_.file_size - offset_, config_.encoding);
+            if (written == 0) {
+                errors_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        offset_ += written;
+        frames_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(written, std::memory_order_relaxed);
+    }
+
+    void run(uint32_t timeout_ms) noexcept {
+        size_t ready[WaitSet::kCapacity];
+        while (running_.load(std::memory_order_acquire)) {
+            if (poll() == 0) {
+                wait_set_.wait(ready, WaitSet::kCapacity, timeout_ms);
+            }
+        }
+        poll();
+    }
+
+public:
+    Recorder() = default;
+
+    ~Recorder() {
+        stop();
+        close();
+        for (size_t i = 0; i < entry_count_; ++i) {
+            entries_[i].metadata->unsubscribe(entries_[i].token);
+        }
+    }
+
+    // İlk dosyayı oluşturur (<path>.0)
+    bool open(const RecorderConfig& config) noexcept {
+        if (map_) return true;
+        if (!config.path || config.file_size <= sizeof(log::FileHeader)) return false;
+        config_ = config;
+        snprintf(path_, sizeof(path_), "%s", config.path);
+        return open_file(0);
+    }
+
+    void close() noexcept {
+        close_file();
+    }
+
+    bool is_open() const noexcept {
+        return map_ != nullptr;
+    }
+
+    // Topic'e abone olur. nanopb tanımlayıcısı ve ham yerleşimi olmayan veya
+    // MREQ_RECORDER_MAX_PAYLOAD'dan büyük topic'ler kaydedilemez.
+    bool add(const mreq_metadata* metadata) {
+        if (!metadata || (!metadata->fields && !metadata->raw_capable()) || !metadata->read_info_fn ||
+            metadata->payload_size > sizeof(scratch_) || entry_count_ == MREQ_RECORDER_MAX_TOPICS ||
+            running_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        std::optional<Token> token = metadata->subscribe();
+        if (!token) return false;
+        entries_[entry_count_++] = {metadata, token.value()};
+        // Listener desteklemeyen topic'ler (ShmTopic) zaman aşımıyla yoklanır
+        wait_set_.add(metadata, token.value());
+        return true;
+    }
+
+    // Registry'deki topic'i message_id ile ekler
+    bool add(size_t message_id) {
+        return add(TopicRegistry::instance().find_by_id(message_id));
+    }
+
+    // Tüm topic'lerdeki okunmamış mesajları yazar; yazılan çerçeve sayısını döndürür
+    size_t poll() noexcept {
+        if (!map_) return 0;
+        const uint64_t before = frames_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < entry_count_; ++i) {
+            const Entry& entry = entries_[i];
+            ReadInfo info;
+            while (entry.metadata->read_info_fn(entry.metadata->topic_instance, entry.token, scratch_, &info)) {
+                if (info.dropped) dropped_.fetch_add(info.dropped, std::memory_order_relaxed);
+                write_frame(*entry.metadata, scratch_, info);
+            }
+        }
+        return static_cast<size_t>(frames_.load(std::memory_order_relaxed) - before);
+    }
+
+    // Arka plan thread'i: publish bildirimi ya da timeout_ms ile uyanıp poll() yapar
+    bool start(uint32_t timeout_ms = 10) {
+        if (!map_ || running_.exchange(true)) return false;
+        thread_ = std::thread([this, timeout_ms] { run(timeout_ms); });
+        return true;
+    }
+
+    // Thread'i durdurur; kalan mesajlar yazıldıktan sonra döner
+    void stop() {
+        if (!running_.exchange(false)) return;
+        if (thread_.joinable()) thread_.join();
+    }
+
+    uint64_t frames_written() const noexcept { return frames_.load(std::memory_order_relaxed); }
+    uint64_t bytes_written() const noexcept { return bytes_.load(std::memory_order_relaxed); }
+    // Recorder geride kaldığı için ring'de üzerine yazılan mesajlar
+    uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+    // Kodlanamayan, dosyaya sığmayan mesajlar ve dosya hataları
+    uint64_t errors() const noexcept { return errors_.load(std::memory_order_relaxed); }
+    size_t file_index() const noexcept { return file_index_; }
+};
+
+} // namespace mreq
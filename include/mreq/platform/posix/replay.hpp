@@ -0,0 +1,206 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <chrono>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mreq/clock.hpp"
+#include "mreq/log_format.hpp"
+#include "mreq/metadata.hpp"
+#include "mreq/topic_registry.hpp"
+#include "mreq/internal/NonCopyable.hpp"
+
+// Oynatılabilecek en büyük mesaj struct'ı (decode için önceden ayrılmış tampon)
+#ifndef MREQ_REPLAY_MAX_PAYLOAD
+#define MREQ_REPLAY_MAX_PAYLOAD 1024
+#endif
+
+namespace mreq {
+
+// Recorder dosyasını salt-okunur mmap ile açar ve çerçeveleri sırayla, kopyasız verir
+class LogReader : private internal::NonCopyable {
+    const uint8_t* map_ = nullptr;
+    size_t size_ = 0;
+    size_t begin_ = 0;
+    size_t offset_ = 0;
+    uint64_t created_ns_ = 0;
+
+public:
+    LogReader() = default;
+    ~LogReader() { close(); }
+
+    // Dosya başlığı geçersizse false döner
+    bool open(const char* path) noexcept {
+        close();
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        const size_t size = static_cast<size_t>(st.st_size);
+        void* mem = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mem == MAP_FAILED) return false;
+        madvise(mem, size, MADV_SEQUENTIAL);
+
+        const size_t begin = log::parse_file_header(mem, size);
+        if (begin == 0) {
+            munmap(mem, size);
+            return false;
+        }
+        log::FileHeader header;
+        std::memcpy(&header, mem, sizeof(header));
+
+        map_ = static_cast<const uint8_t*>(mem);
+        size_ = size;
+        begin_ = offset_ = begin;
+        created_ns_ = header.created_ns;
+        return true;
+    }
+
+    void close() noexcept {
+        if (map_) {
+            munmap(const_cast<uint8_t*>(map_), size_);
+            map_ = nullptr;
+        }
+        size_ = begin_ = offset_ = 0;
+    }
+
+    bool is_open() const noexcept { return map_ != nullptr; }
+
+    // Sıradaki çerçeve; payload, reader açık kaldığı sürece geçerlidir
+    bool next(log::Frame& frame) noexcept {
+        return map_ && log::next_frame(map_, size_, offset_, frame);
+    }
+
+    void rewind() noexcept { offset_ = begin_; }
+
+    uint64_t created_ns() const noexcept { return created_ns_; }
+};
+
+// Kayıtları registry'deki topic'lere geri yayınlar.
+// Her çerçevenin topic'i message_id ile bulunur, payload log::decode_frame ile (nanopb ya da
+// parmak izi tutan ham çerçevede memcpy) önceden ayrılmış tampona çözülür ve publish_fn ile
+// yayınlanır; mesaj başına heap ayrımı yoktur.
+// RealTime modu kayıttaki aralıkları (speed ile ölçeklenmiş) korur. AsFastAsPossible modu
+// beklemeden yayınlar; zaman sadece sanal saatte ilerler. Bu modda ilk çerçeveden itibaren
+// Replayer yaşadığı sürece mreq::now_ns() de sanal saati döndürür (throttle edilen abonelikler,
+// Recorder zaman damgaları ve istatistikler kayıt zamanını görür); zaman aşımları etkilenmez.
+// Aynı anda tek Replayer saati sürer.
+class Replayer : private internal::NonCopyable {
+public:
+    enum class Mode { RealTime, AsFastAsPossible };
+
+private:
+    Mode mode_;
+    double speed_;
+    alignas(std::max_align_t) uint8_t scratch_[MREQ_REPLAY_MAX_PAYLOAD];
+
+    bool started_ = false;
+    uint64_t first_log_ns_ = 0;     // Oynatılan ilk çerçevenin zaman damgası
+    uint64_t first_wall_ns_ = 0;    // O çerçevenin yayınlandığı gerçek an
+    std::atomic<uint64_t> virtual_ns_{0};   // Son yayınlanan çerçevenin zaman damgası
+    bool drives_clock_ = false;     // mreq::now_ns() bu sanal saati döndürüyor
+
+    uint64_t published_ = 0;
+    uint64_t unknown_ = 0;
+    uint64_t errors_ = 0;
+
+    void wait_until(uint64_t log_ns) const {
+        const double elapsed = static_cast<double>(log_ns - first_log_ns_) / speed_;
+        const uint64_t target = first_wall_ns_ + static_cast<uint64_t>(elapsed);
+        const uint64_t now = mreq::monotonic_ns();
+        if (target > now) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(target - now));
+        }
+    }
+
+public:
+    explicit Replayer(Mode mode = Mode::AsFastAsPossible, double speed = 1.0)
+        : mode_(mode), speed_(speed > 0.0 ? speed : 1.0) {}
+
+    ~Replayer() {
+        if (drives_clock_) internal::virtual_clock.store(nullptr, std::memory_order_release);
+    }
+
+    // Tek bir çerçeveyi yayınlar. Registry'de olmayan ya da çözülemeyen çerçeveler atlanır.
+    bool publish(const log::Frame& frame) {
+        const mreq_metadata* metadata = TopicRegistry::instance().find_by_id(static_cast<size_t>(frame.header.message_id));
+        if (!metadata || !metadata->publish_fn) {
+            ++unknown_;
+            return false;
+        }
+        if (metadata->payload_size > sizeof(scratch_) ||
+            !log::decode_frame(*metadata, frame, scratch_)) {
+            ++errors_;
+            return false;
+        }
+
+        if (frame.header.timestamp_ns > virtual_ns_.load(std::memory_order_relaxed)) {
+            virtual_ns_.store(frame.header.timestamp_ns, std::memory_order_relaxed);
+        }
+        if (!started_) {
+            started_ = true;
+            first_log_ns_ = frame.header.timestamp_ns;
+            first_wall_ns_ = mreq::monotonic_ns();
+            if (mode_ == Mode::AsFastAsPossible) {
+                const std::atomic<uint64_t>* expected = nullptr;
+                drives_clock_ = internal::virtual_clock.compare_exchange_strong(expected, &virtual_ns_);
+            }
+        } else if (mode_ == Mode::RealTime && frame.header.timestamp_ns > first_log_ns_) {
+            wait_until(frame.header.timestamp_ns);
+        }
+
+        metadata->publish(scratch_);
+        ++published_;
+        return true;
+    }
+
+    // Reader'daki kalan tüm çerçeveleri oynatır; yayınlanan mesaj sayısını döndürür
+    size_t play(LogReader& reader) {
+        size_t count = 0;
+        log::Frame frame{};
+        while (reader.next(frame)) {
+            count += publish(frame);
+        }
+        return count;
+    }
+
+    size_t play(const char* path) {
+        LogReader reader;
+        return reader.open(path) ? play(reader) : 0;
+    }
+
+    // Recorder rotation dosyalarını (<prefix>.<first>, <prefix>.<first + 1>, ...) ilk eksik
+    // dosyaya kadar sırayla oynatır
+    size_t play_rotated(const char* prefix, size_t first_index = 0) {
+        size_t count = 0;
+        char name[300];
+        LogReader reader;
+        for (size_t i = first_index;; ++i) {
+            snprintf(name, sizeof(name), "%s.%zu", prefix, i);
+            if (!reader.open(name)) break;
+            count += play(reader);
+        }
+        return count;
+    }
+
+    // Sanal saat: son yayınlanan mesajın kayıt zamanı (mreq::now_ns tabanında)
+    uint64_t now_ns() const noexcept { return virtual_ns_.load(std::memory_order_relaxed); }
+
+    uint64_t published() const noexcept { return published_; }
+    // Registry'de topic'i bulunamayan çerçeveler
+    uint64_t unknown() const noexcept { return unknown_; }
+    // Çözülemeyen çerçeveler (parmak izi tutmayan ham çerçeveler dahil)
+    uint64_t errors() const noexcept { return errors_; }
+};
+
+} // namespace mreq
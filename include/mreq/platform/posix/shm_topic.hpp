@@ -0,0 +1,304 @@
+#pragma once
+#include <optional>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mreq/metadata.hpp"
+#include "mreq/subscriber_table.hpp"
+#include "mreq/internal/NonCopyable.hpp"
+#include "mreq/internal/SequencedRing.hpp"
+#include "mreq/internal/TopicOps.hpp"
+#include "mreq/internal/TopicStats.hpp"
+
+// Paylaşımlı bellek segment adı öneki: <önek><message_id hex>
+#ifndef MREQ_SHM_PREFIX
+#define MREQ_SHM_PREFIX "/mreq_"
+#endif
+
+using Token = size_t;
+
+namespace mreq {
+
+namespace internal {
+
+// Paylaşımlı bellekteki abone kaydı (süreçler arası, sadece kilitsiz atomikler)
+struct ShmSubscriber {
+    std::atomic<uint32_t> active{0};
+    std::atomic<size_t> last_read_seq{0};
+};
+
+// shm_open/mmap bölgesinin yerleşimi. Tüm alanlar süreçler arası paylaşılır.
+template<typename T, size_t N, size_t MaxSubscribers>
+struct ShmTopicRegion {
+    static constexpr uint32_t kVersion = 2;
+    enum : uint32_t { kUninitialized = 0, kInitializing = 1, kReady = 2 };
+
+    std::atomic<uint32_t> state{kUninitialized};
+    uint32_t version = kVersion;
+    uint64_t payload_size = sizeof(T);
+    uint64_t capacity = N;
+    uint64_t max_subscribers = MaxSubscribers;
+    uint64_t abi_fingerprint = raw_fingerprint<T>();   // MREQ_RAW_LAYOUT ile işaretli tiplerde
+    SequencedRing<T, N> ring{};
+    ShmSubscriber subscribers[MaxSubscribers]{};
+
+    // state dışındaki alanları yerinde kurar. Bölgenin tamamı yeniden kurulmaz: Region()
+    // state'i kUninitialized'a geri yazar ve bekleyen başka bir süreç bölgeyi ikinci kez başlatabilir
+    void initialize() noexcept {
+        version = kVersion;
+        payload_size = sizeof(T);
+        capacity = N;
+        max_subscribers = MaxSubscribers;
+        abi_fingerprint = raw_fingerprint<T>();
+        new (&ring) SequencedRing<T, N>{};
+        for (ShmSubscriber& sub : subscribers) new (&sub) ShmSubscriber{};
+    }
+
+    bool layout_matches() const noexcept {
+        return version == kVersion && payload_size == sizeof(T) && capacity == N &&
+               max_subscribers == MaxSubscribers && abi_fingerprint == raw_fingerprint<T>();
+    }
+};
+
+} // namespace internal
+
+// POSIX paylaşımlı bellek üzerinde topic.
+// Ring buffer ve abone tablosu, topic'in message_id'si ile adlandırılan bir shm_open/mmap
+// bölgesinde yaşar; aynı topic'i tanımlayan ayrı süreçler aynı polling API'si ile,
+// serileştirme veya soket kopyası olmadan publish/subscribe yapabilir.
+// Çok yazıcılı kilitsiz ring (internal::SequencedRing) kullanılır; T trivially copyable olmalıdır.
+// Not: Çöken bir sürecin abone slotu serbest kalmaz; segment unlink() ile temizlenebilir.
+template<typename T, size_t N = 1, size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS>
+class ShmTopic : public internal::TopicOps<ShmTopic<T, N, MaxSubscribers>, T>, private internal::NonCopyable {
+public:
+    using value_type = T;
+    using Region = internal::ShmTopicRegion<T, N, MaxSubscribers>;
+private:
+    Region* region_ = nullptr;
+    int fd_ = -1;
+    // Sayaçlar süreç yereldir: sadece bu süreçteki publish/read'leri sayar
+    mutable internal::TopicStats<MaxSubscribers> stats_;
+
+    // Metadata pointer for this topic instance
+    const mreq_metadata* metadata_ = nullptr;
+
+    static void segment_name(size_t message_id, char* out, size_t out_size) noexcept {
+        snprintf(out, out_size, "%s%zx", MREQ_SHM_PREFIX, message_id);
+    }
+
+    internal::ShmSubscriber* subscriber(Token token) const noexcept {
+        if (!region_ || token >= MaxSubscribers) return nullptr;
+        internal::ShmSubscriber* sub = &region_->subscribers[token];
+        return sub->active.load(std::memory_order_acquire) ? sub : nullptr;
+    }
+
+public:
+    explicit ShmTopic(const mreq_metadata* metadata = nullptr) {
+        if (metadata) bind_metadata(metadata);
+    }
+
+    ~ShmTopic() { close(); }
+
+    // Metadata bağlanınca segment message_id ile açılır
+    void bind_metadata(const mreq_metadata* metadata) {
+        metadata_ = metadata;
+        if (metadata && !region_ && !open(metadata->message_id)) {
+#ifdef MREQ_ENABLE_LOGGING
+            printf("SHM_TOPIC[%s]: Shared memory segment could not be opened\n", metadata->topic_name);
+#endif
+        }
+    }
+
+    const mreq_metadata* get_metadata() const {
+        return metadata_;
+    }
+
+    // Segmenti aç (yoksa oluştur ve başlat). Yerleşim uyuşmazsa false döner.
+    bool open(size_t message_id) noexcept {
+        if (region_) return true;
+
+        char name[64];
+        segment_name(message_id, name, sizeof(name));
+
+        int fd = shm_open(name, O_RDWR | O_CREAT, 0600);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 ||
+            (st.st_size != 0 && static_cast<size_t>(st.st_size) != sizeof(Region)) ||
+            (st.st_size == 0 && ftruncate(fd, sizeof(Region)) != 0)) {
+            ::close(fd);
+            return false;
+        }
+
+        void* mem = mmap(nullptr, sizeof(Region), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mem == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+
+        // ftruncate bölgeyi sıfırlar; state == 0 iken ilk gelen bölgeyi başlatır
+        Region* region = static_cast<Region*>(mem);
+        uint32_t expected = Region::kUninitialized;
+        if (region->state.compare_exchange_strong(expected, Region::kInitializing,
+                                                  std::memory_order_acq_rel)) {
+            region->initialize();
+            region->state.store(Region::kReady, std::memory_order_release);
+        } else {
+            // Başka bir süreç başlatıyor olabilir: sınırlı süre bekle
+            internal::Backoff backoff;
+            for (int i = 0; i < 100000 && region->state.load(std::memory_order_acquire) != Region::kReady; ++i) {
+                backoff.pause();
+            }
+        }
+
+        if (region->state.load(std::memory_order_acquire) != Region::kReady || !region->layout_matches()) {
+            munmap(mem, sizeof(Region));
+            ::close(fd);
+            return false;
+        }
+
+        region_ = region;
+        fd_ = fd;
+        return true;
+    }
+
+    void close() noexcept {
+        if (region_) {
+            munmap(region_, sizeof(Region));
+            region_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    bool is_open() const noexcept {
+        return region_ != nullptr;
+    }
+
+    // Segmenti sistemden kaldırır (açık eşlemeler geçerli kalır)
+    static bool unlink(size_t message_id) noexcept {
+        char name[64];
+        segment_name(message_id, name, sizeof(name));
+        return shm_unlink(name) == 0;
+    }
+
+    // Herhangi bir süreç/thread'den eşzamanlı çağrılabilir
+    void publish(const T& msg) noexcept {
+        if (!region_) return;
+        [[maybe_unused]] const size_t seq = region_->ring.publish(msg);
+        stats_.on_publish();
+
+#ifdef MREQ_ENABLE_LOGGING
+        printf("SHM_TOPIC[%s]: Published seq=%zu\n",
+               metadata_ ? metadata_->topic_name : "unknown", seq);
+#endif
+    }
+
+    void publish_multiple(const T* msgs, size_t count) noexcept {
+        if (!region_ || count == 0) return;
+        region_->ring.publish_multiple(msgs, count);
+        stats_.on_publish(count);
+    }
+
+    std::optional<Token> subscribe() noexcept {
+        if (!region_) return std::nullopt;
+        for (size_t i = 0; i < MaxSubscribers; ++i) {
+            internal::ShmSubscriber& sub = region_->subscribers[i];
+            uint32_t expected = 0;
+            if (sub.active.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) {
+                // Abone sadece abonelik sonrası talep edilen mesajları okur
+                sub.last_read_seq.store(region_->ring.head(), std::memory_order_relaxed);
+                stats_.on_subscribe(i);
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void unsubscribe(Token token) noexcept {
+        if (internal::ShmSubscriber* sub = subscriber(token)) {
+            sub->active.store(0, std::memory_order_release);
+        }
+    }
+
+    // Token bu segmentte etkin bir abonelik mi
+    bool subscribed(Token token) const noexcept {
+        return subscriber(token) != nullptr;
+    }
+
+    bool check(Token token) const noexcept {
+        const internal::ShmSubscriber* sub = subscriber(token);
+        return sub && region_->ring.has_next(sub->last_read_seq);
+    }
+
+    std::optional<T> read(Token token) const noexcept {
+        ReadInfo info;
+        return read(token, info);
+    }
+
+    // Mesajla birlikte sequence numarasını ve öncesinde kaçırılan mesaj sayısını döndürür
+    std::optional<T> read(Token token, ReadInfo& info) const noexcept {
+        internal::ShmSubscriber* sub = subscriber(token);
+        if (!sub) return std::nullopt;
+
+        const size_t before = sub->last_read_seq.load(std::memory_order_relaxed);
+        T msg;
+        if (region_->ring.try_read_next(sub->last_read_seq, msg)) {
+            info.sequence = sub->last_read_seq.load(std::memory_order_relaxed);
+            info.dropped = info.sequence - before - 1;
+            stats_.on_read(token, 1, info.dropped);
+            return msg;
+        }
+        return std::nullopt;
+    }
+
+    size_t read_multiple(Token token, T* out_buffer, size_t count) const noexcept {
+        ReadInfo info;
+        return read_multiple(token, out_buffer, count, info);
+    }
+
+    // info.sequence: son okunan mesaj, info.dropped: bu çağrıda atlanan toplam mesaj
+    size_t read_multiple(Token token, T* out_buffer, size_t count, ReadInfo& info) const noexcept {
+        info.dropped = 0;
+        internal::ShmSubscriber* sub = subscriber(token);
+        if (!sub) return 0;
+
+        const size_t before = sub->last_read_seq.load(std::memory_order_relaxed);
+        size_t messages_read = 0;
+        while (messages_read < count && region_->ring.try_read_next(sub->last_read_seq, out_buffer[messages_read])) {
+            ++messages_read;
+        }
+        const size_t after = sub->last_read_seq.load(std::memory_order_relaxed);
+        if (messages_read > 0) info.sequence = after;
+        info.dropped = after - before - messages_read;
+        stats_.on_read(token, messages_read, info.dropped);
+        return messages_read;
+    }
+
+    void stats(TopicStatsSnapshot& out) const noexcept {
+        out.topic_name = metadata_ ? metadata_->topic_name : nullptr;
+        out.subscriber_count = 0;
+        if (region_) internal::fill_subscriber_lag(region_->subscribers, region_->ring.head(), out);
+        stats_.fill(out);
+    }
+
+    // Diğer süreçlerin publish'leri yerel listener'lara ulaşmaz: desteklenmez
+    bool attach_listener(const internal::TopicListener*) noexcept {
+        return false;
+    }
+
+    void detach_listener(const internal::TopicListener*) noexcept {}
+};
+
+} // namespace mreq
+
+#define REGISTER_SHM_TOPIC(MSGTYPE, NAME, BUFFER_SIZE) \
+    MREQ_TOPIC_DEFINE_AS(NAME, mreq::ShmTopic<MSGTYPE, BUFFER_SIZE>)
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "pb.h"
+
+namespace mreq {
+
+// Ham (memcpy) wire modu için derleme zamanı ABI parmak izi.
+// Varsayılan 0'dır: tip ham modu desteklemez ve taşıyıcılar nanopb kullanır.
+// MREQ_RAW_LAYOUT(type) ile işaretlenen tiplerde parmak izi; tip adı, sizeof/alignof,
+// byte order ve nanopb FIELDLIST'indeki her alanın tag/tip/offset/boyut bilgisinden hesaplanır.
+// İki uçta parmak izleri eşitse struct baytları tek memcpy ile taşınabilir.
+template<typename T>
+struct RawLayout {
+    static constexpr uint64_t fingerprint = 0;
+};
+
+template<typename T>
+constexpr uint64_t raw_fingerprint() noexcept {
+    return RawLayout<T>::fingerprint;
+}
+
+namespace internal {
+
+constexpr uint64_t kFnvOffset = 0xcbf29ce484222325ull;
+constexpr uint64_t kFnvPrime = 0x100000001b3ull;
+
+constexpr uint64_t abi_mix(uint64_t hash, uint64_t value) noexcept {
+    for (int i = 0; i < 8; ++i) {
+        hash = (hash ^ ((value >> (i * 8)) & 0xFFu)) * kFnvPrime;
+    }
+    return hash;
+}
+
+constexpr uint64_t abi_mix(uint64_t hash, const char* str) noexcept {
+    while (*str) {
+        hash = (hash ^ static_cast<uint8_t>(*str++)) * kFnvPrime;
+    }
+    return hash;
+}
+
+constexpr uint64_t abi_seed(const char* type_name, size_t size, size_t align) noexcept {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    constexpr uint64_t byte_order = 2;
+#else
+    constexpr uint64_t byte_order = 1;
+#endif
+    return abi_mix(abi_mix(abi_mix(abi_mix(kFnvOffset, type_name), size), align), byte_order);
+}
+
+constexpr uint64_t abi_field(uint64_t hash, uint32_t tag, uint32_t type, size_t data_offset,
+                             size_t data_size, ptrdiff_t size_offset, size_t array_size) noexcept {
+    hash = abi_mix(hash, tag);
+    hash = abi_mix(hash, type);
+    hash = abi_mix(hash, data_offset);
+    hash = abi_mix(hash, data_size);
+    hash = abi_mix(hash, static_cast<uint64_t>(size_offset));
+    return abi_mix(hash, array_size);
+}
+
+} // namespace internal
+} // namespace mreq
+
+// FIELDLIST X-makrosu: alan yerleşimini nanopb'nin kendi offset/boyut makrolarıyla karıştırır
+#define MREQ_RAW_LAYOUT_FIELD(structname, atype, htype, ltype, fieldname, tag) \
+    hash = ::mreq::internal::abi_field(hash, tag, \
+        PB_ATYPE_##atype | PB_HTYPE_##htype | PB_LTYPE_MAP_##ltype, \
+        PB_DATA_OFFSET_##atype(_PB_HTYPE_##htype, structname, fieldname), \
+        PB_DATA_SIZE_##atype(_PB_HTYPE_##htype, structname, fieldname), \
+        PB_SIZE_OFFSET_##atype(_PB_HTYPE_##htype, structname, fieldname), \
+        PB_ARRAY_SIZE_##atype(_PB_HTYPE_##htype, structname, fieldname)); \
+    raw = raw && (PB_ATYPE_##atype) == PB_ATYPE_STATIC;
+
+// Tipi ham wire moduna açar. nanopb .pb.h'ından (type##_FIELDLIST) sonra, global kapsamda ve
+// tipi kullanan her çeviri biriminin göreceği yerde (tipin başlığında) bir kez yazılmalıdır.
+// Pointer/callback alanlı veya trivially copyable olmayan tipler derleme hatası verir.
+// Not: Alt mesaj alanlarının iç yerleşimi sadece boyutlarıyla parmak izine girer.
+#define MREQ_RAW_LAYOUT(type) \
+    template<> \
+    struct mreq::RawLayout<type> { \
+        static constexpr uint64_t fingerprint = [] { \
+            uint64_t hash = ::mreq::internal::abi_seed(#type, sizeof(type), alignof(type)); \
+            bool raw = std::is_trivially_copyable<type>::value; \
+            type##_FIELDLIST(MREQ_RAW_LAYOUT_FIELD, type) \
+            return raw ? (hash | 1u) : uint64_t{0}; \
+        }(); \
+        static_assert(fingerprint != 0, #type " memcpy ile taşınamaz (pointer/callback alanı var)"); \
+    };
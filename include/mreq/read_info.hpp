@@ -0,0 +1,14 @@
+#pragma once
+#include <cstddef>
+
+namespace mreq {
+
+// read()/read_multiple() çağrısının ek bilgisi.
+// Abone geride kalıp ring üzerine yazıldığında atlanan mesajlar dropped ile bildirilir;
+// bu sayılar @buffer boyutlarını ayarlamak ve yavaş tüketicileri yakalamak için kullanılır.
+struct ReadInfo {
+    size_t sequence = 0;   // Son okunan mesajın sequence numarası (ilk publish = 1)
+    size_t dropped = 0;    // Bu okumada atlanan (kaybolan) mesaj sayısı
+};
+
+} // namespace mreq
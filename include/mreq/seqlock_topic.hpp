@@ -0,0 +1,258 @@
+#pragma once
+#include <optional>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+#include <cstdio> // For printf
+#include "subscriber_table.hpp"
+#include "mreq/internal/TopicOps.hpp"
+#include "mreq/internal/TopicStats.hpp"
+
+using Token = size_t;
+
+namespace mreq {
+
+struct mreq_metadata;
+
+// Tek yazıcılı (single-producer), kilitsiz topic.
+// publish() her ring slotunu kendi sequence sayacı altında yazar; okuyucular
+// yırtık (torn) okuma tespit ettiğinde tekrar dener. publish/read/check hiçbir
+// mutex almaz. Aynı topic'e birden fazla thread publish ETMEMELİDİR.
+template<typename T, size_t N = 1, size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS>
+class SeqlockTopic : public internal::TopicOps<SeqlockTopic<T, N, MaxSubscribers>, T> {
+public:
+    using value_type = T;
+private:
+    static_assert(N >= 1, "Buffer boyutu en az 1 olmalı");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SeqlockTopic mesaj tipinin trivially copyable olmasını gerektirir");
+
+    // Slot sequence kodlaması: 0 = boş, 2*s - 1 = s. mesaj yazılıyor, 2*s = s. mesaj hazır
+    struct MREQ_CACHE_ALIGNED RingSlot {
+        std::atomic<size_t> seq{0};
+        T data{};
+    };
+
+    std::array<RingSlot, N> ring_{};
+    MREQ_CACHE_ALIGNED std::atomic<size_t> sequence_{0};
+    mutable SubscriberTable<T, MaxSubscribers> subscribers_;
+    internal::TopicListeners listeners_;
+    mutable internal::TopicStats<MaxSubscribers> stats_;
+
+    // Metadata pointer for this topic instance
+    const mreq_metadata* metadata_ = nullptr;
+
+    // Okuyucunun bir sonraki mesajı kopyalamayı denemesi.
+    // Başarılıysa true döner ve last_read_seq ilerletilir.
+    bool try_read_next(SubscriberSlot& slot, T& out) const noexcept {
+        for (;;) {
+            const size_t head = sequence_.load(std::memory_order_acquire);
+            const size_t last_read_seq = slot.last_read_seq.load(std::memory_order_relaxed);
+            if (last_read_seq >= head) {
+                return false;
+            }
+
+            // Abone geride kaldıysa ring'deki en eski mesaja atla
+            size_t next = last_read_seq + 1;
+            if (head - last_read_seq > N) {
+                next = head - N + 1;
+            }
+
+            const RingSlot& rs = ring_[(next - 1) % N];
+            const size_t before = rs.seq.load(std::memory_order_acquire);
+            if (before != 2 * next) {
+                // Slot daha yeni bir mesajla (yeniden) yazılıyor: bu mesaj kayıp, atla
+                slot.last_read_seq.store(next, std::memory_order_relaxed);
+                continue;
+            }
+
+            std::memcpy(&out, &rs.data, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (rs.seq.load(std::memory_order_relaxed) != before) {
+                // Yırtık okuma: kopyalama sırasında üzerine yazıldı, mesaj kayıp
+                slot.last_read_seq.store(next, std::memory_order_relaxed);
+                continue;
+            }
+
+            slot.last_read_seq.store(next, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+public:
+    // Publisher'ın mesajı doğrudan ring slotunda oluşturması için ödünç alma (zero-copy).
+    // Yazım süresince slot "yazılıyor" olarak işaretlidir; bu slottaki en eski mesajı
+    // bekleyen okuyucular onu atlar. commit() edilmeden yok edilirse mesaj yayınlanmaz.
+    class Loan {
+    public:
+        Loan(Loan&& other) noexcept : topic_(other.topic_), seq_(other.seq_) { other.topic_ = nullptr; }
+        Loan(const Loan&) = delete;
+        Loan& operator=(const Loan&) = delete;
+        Loan& operator=(Loan&&) = delete;
+        ~Loan() = default;
+
+        T& get() noexcept { return topic_->ring_[(seq_ - 1) % N].data; }
+        T& operator*() noexcept { return get(); }
+        T* operator->() noexcept { return &get(); }
+
+        void commit() noexcept {
+            if (!topic_) return;
+            topic_->ring_[(seq_ - 1) % N].seq.store(2 * seq_, std::memory_order_release);
+            topic_->sequence_.store(seq_, std::memory_order_release);
+            topic_->stats_.on_publish();
+            topic_->listeners_.notify();
+            topic_ = nullptr;
+        }
+
+    private:
+        friend class SeqlockTopic;
+        explicit Loan(SeqlockTopic* topic)
+            : topic_(topic), seq_(topic->sequence_.load(std::memory_order_relaxed) + 1) {
+            topic_->ring_[(seq_ - 1) % N].seq.store(2 * seq_ - 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+        SeqlockTopic* topic_;
+        size_t seq_;
+    };
+
+    explicit SeqlockTopic(const mreq_metadata* metadata = nullptr) : metadata_(metadata) {}
+
+    void bind_metadata(const mreq_metadata* metadata) {
+        metadata_ = metadata;
+    }
+
+    const mreq_metadata* get_metadata() const {
+        return metadata_;
+    }
+
+    // Sadece tek bir yazıcı thread'inden çağrılmalıdır
+    Loan loan() noexcept {
+        return Loan(this);
+    }
+
+    // Sadece tek bir yazıcı thread'inden çağrılmalıdır
+    void publish(const T& msg) noexcept {
+        const size_t seq = sequence_.load(std::memory_order_relaxed) + 1;
+        RingSlot& rs = ring_[(seq - 1) % N];
+
+        rs.seq.store(2 * seq - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&rs.data, &msg, sizeof(T));
+        rs.seq.store(2 * seq, std::memory_order_release);
+
+        sequence_.store(seq, std::memory_order_release);
+        stats_.on_publish();
+        listeners_.notify();
+
+#ifdef MREQ_ENABLE_LOGGING
+        printf("SEQLOCK_TOPIC: Published seq=%zu\n", seq);
+#endif
+    }
+
+    // Sadece tek bir yazıcı thread'inden çağrılmalıdır. Slotlar tek tek yazılır, sequence_
+    // bir kez ilerler; count > N ise sadece son N mesaj yazılır (öncekiler kaçırılmış sayılır).
+    void publish_multiple(const T* msgs, size_t count) noexcept {
+        if (count == 0) return;
+        const size_t first = sequence_.load(std::memory_order_relaxed) + 1;
+        const size_t last = first + count - 1;
+        const size_t skip = count > N ? count - N : 0;
+
+        for (size_t seq = first + skip; seq <= last; ++seq) {
+            RingSlot& rs = ring_[(seq - 1) % N];
+            rs.seq.store(2 * seq - 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            std::memcpy(&rs.data, &msgs[seq - first], sizeof(T));
+            rs.seq.store(2 * seq, std::memory_order_release);
+        }
+
+        sequence_.store(last, std::memory_order_release);
+        stats_.on_publish(count);
+        listeners_.notify();
+    }
+
+    std::optional<Token> subscribe() {
+        std::optional<Token> token_opt = subscribers_.subscribe();
+        if (token_opt.has_value()) {
+            stats_.on_subscribe(token_opt.value());
+            // Abone sadece abonelik sonrası yayınlanan mesajları okur
+            subscribers_.update_read_state(token_opt.value(),
+                                           sequence_.load(std::memory_order_acquire), 0);
+        }
+        return token_opt;
+    }
+
+    std::optional<T> read(Token token) const noexcept {
+        ReadInfo info;
+        return read(token, info);
+    }
+
+    // Mesajla birlikte sequence numarasını ve öncesinde kaçırılan mesaj sayısını döndürür
+    std::optional<T> read(Token token, ReadInfo& info) const noexcept {
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (!slot.active.load(std::memory_order_relaxed)) return std::nullopt;
+
+        const size_t before = slot.last_read_seq.load(std::memory_order_relaxed);
+        T msg;
+        if (try_read_next(slot, msg)) {
+            info.sequence = slot.last_read_seq.load(std::memory_order_relaxed);
+            info.dropped = info.sequence - before - 1;
+            stats_.on_read(token, 1, info.dropped);
+            return msg;
+        }
+        return std::nullopt;
+    }
+
+    size_t read_multiple(Token token, T* out_buffer, size_t count) const noexcept {
+        ReadInfo info;
+        return read_multiple(token, out_buffer, count, info);
+    }
+
+    // info.sequence: son okunan mesaj, info.dropped: bu çağrıda atlanan toplam mesaj
+    size_t read_multiple(Token token, T* out_buffer, size_t count, ReadInfo& info) const noexcept {
+        info.dropped = 0;
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (!slot.active.load(std::memory_order_relaxed)) return 0;
+
+        const size_t before = slot.last_read_seq.load(std::memory_order_relaxed);
+        size_t messages_read = 0;
+        while (messages_read < count && try_read_next(slot, out_buffer[messages_read])) {
+            ++messages_read;
+        }
+        const size_t after = slot.last_read_seq.load(std::memory_order_relaxed);
+        if (messages_read > 0) info.sequence = after;
+        info.dropped = after - before - messages_read;
+        stats_.on_read(token, messages_read, info.dropped);
+        return messages_read;
+    }
+
+    void unsubscribe(Token token) noexcept {
+        subscribers_.unsubscribe(token);
+    }
+
+    // Token etkin bir abonelik mi (unsubscribe edilmemiş)
+    bool subscribed(Token token) const noexcept {
+        return subscribers_.is_active(token);
+    }
+
+    bool check(Token token) const noexcept {
+        return subscribers_.check(token, sequence_.load(std::memory_order_acquire));
+    }
+
+    void stats(TopicStatsSnapshot& out) const noexcept {
+        out.topic_name = metadata_ ? metadata_->topic_name : nullptr;
+        internal::fill_subscriber_lag(subscribers_, sequence_.load(std::memory_order_acquire), out);
+        stats_.fill(out);
+    }
+
+    bool attach_listener(const internal::TopicListener* listener) noexcept {
+        return listeners_.attach(listener);
+    }
+
+    void detach_listener(const internal::TopicListener* listener) noexcept {
+        listeners_.detach(listener);
+    }
+};
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace mreq {
+
+namespace internal {
+
+template<typename T>
+struct MemberTraits;
+
+template<typename Class, typename Field>
+struct MemberTraits<Field Class::*> {
+    using class_type = Class;
+    using field_type = Field;
+};
+
+// Tip başına benzersiz adres: filtrenin hangi mesaj tipi için kurulduğunu taşır
+template<typename T>
+inline const void* type_tag() noexcept {
+    static const char tag = 0;
+    return &tag;
+}
+
+} // namespace internal
+
+// Topic ring'indeki mesajı yerinde (kopyalamadan) değerlendiren tip-silinmiş içerik filtresi.
+// where(&fonksiyon) ile fonksiyon pointer'ı, field_equals<&Msg::alan>(değer) ile derleme
+// zamanında seçilen alan üzerinde eşitlik filtresi kurulur (nanopb STATIC skaler alanlar).
+// Filtre topic kilidi altında çağrılır: kısa olmalı ve topic'e geri çağrı yapmamalıdır.
+struct MessageFilter {
+    bool (*match)(const void* msg, const MessageFilter& self) = nullptr;
+    const void* type = nullptr;   // Kurulduğu mesaj tipi; Topic::subscribe() eşleşmezse reddeder
+    void (*fn)() = nullptr;       // where(): kullanıcı predicate'i
+    uint64_t value = 0;           // field_equals(): karşılaştırılan değerin baytları
+
+    explicit operator bool() const noexcept { return match != nullptr; }
+    bool operator()(const void* msg) const { return match(msg, *this); }
+};
+
+template<typename T>
+MessageFilter where(bool (*predicate)(const T&)) noexcept {
+    MessageFilter filter;
+    if (!predicate) return filter;
+    filter.type = internal::type_tag<T>();
+    filter.fn = reinterpret_cast<void (*)()>(predicate);
+    filter.match = [](const void* msg, const MessageFilter& self) {
+        return reinterpret_cast<bool (*)(const T&)>(self.fn)(*static_cast<const T*>(msg));
+    };
+    return filter;
+}
+
+template<auto Field>
+MessageFilter field_equals(typename internal::MemberTraits<decltype(Field)>::field_type value) noexcept {
+    using Traits = internal::MemberTraits<decltype(Field)>;
+    using Class = typename Traits::class_type;
+    using FieldType = typename Traits::field_type;
+    static_assert(std::is_trivially_copyable<FieldType>::value && sizeof(FieldType) <= sizeof(uint64_t),
+                  "field_equals sadece skaler alanlarla kullanılabilir");
+
+    MessageFilter filter;
+    filter.type = internal::type_tag<Class>();
+    std::memcpy(&filter.value, &value, sizeof(FieldType));
+    filter.match = [](const void* msg, const MessageFilter& self) {
+        FieldType expected;
+        std::memcpy(&expected, &self.value, sizeof(FieldType));
+        return static_cast<const Class*>(msg)->*Field == expected;
+    };
+    return filter;
+}
+
+// Yüksek frekanslı topic'lere seçici abonelik (UI, telemetri, fan-in), bkz. Topic::subscribe().
+// Teslim edilmeyen mesajlar kopyalanmaz: okuma sırası doğrudan hedef mesaja taşınır ve bunlar
+// ReadInfo::dropped'a sayılmaz; dropped sadece ring taşmasıyla değerlendirilemeden kaybolan
+// (filtresiz seyreltmede: kaybolan hedef) mesajlardır.
+struct SubscribeOptions {
+    // Abonelikten sonraki (filtre varsa eşleşen) her decimation. mesaj okunur (1: hepsi)
+    uint32_t decimation = 1;
+    // > 0 ise en fazla min_interval_ns'de bir mesaj okunur ve okunan her zaman en güncel
+    // (eşleşen) mesajdır; decimation'dan önceliklidir. Zaman mreq::now_ns() ile ölçülür;
+    // saat kaynağı olmayan bare metal derlemede bu seçenekle subscribe() reddedilir.
+    uint64_t min_interval_ns = 0;
+    // Sadece filtreyi sağlayan mesajlar okunur
+    MessageFilter filter{};
+
+    static SubscribeOptions every(uint32_t n) noexcept {
+        SubscribeOptions options;
+        options.decimation = n > 0 ? n : 1;
+        return options;
+    }
+
+    static SubscribeOptions at_most_every(uint64_t interval_ns) noexcept {
+        SubscribeOptions options;
+        options.min_interval_ns = interval_ns;
+        return options;
+    }
+
+    static SubscribeOptions matching(const MessageFilter& filter) noexcept {
+        SubscribeOptions options;
+        options.filter = filter;
+        return options;
+    }
+};
+
+} // namespace mreq
@@ -1,44 +1,69 @@
 // src/mreq/subscriber_table.hpp
 #pragma once
-#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <atomic>
 #include <optional>
 #include <array>
 #include "mreq/mutex.hpp"
 #include "mreq/internal/LockGuard.hpp"
+#include "mreq/internal/CacheLine.hpp"
 
 #ifndef MREQ_MAX_SUBSCRIBERS
 #define MREQ_MAX_SUBSCRIBERS 8
 #endif
 
 // Abone için kayıt yapısı
-struct SubscriberSlot {
-    bool active = false;
-    size_t last_read_seq = 0;    // Sequence number of the last message read by this subscriber
+// active ve last_read_seq atomiktir: check() yolu hiçbir kilit almadan okur
+// MREQ_CACHE_ALIGNED_LAYOUT ile her slot kendi cache hattındadır (okuyucular arası false sharing yok)
+struct MREQ_CACHE_ALIGNED SubscriberSlot {
+    std::atomic<bool> active{false};
+    bool selective = false;      // Topic'te seyreltilmiş, throttle edilen ya da filtreli abonelik (active'in dolgusunda)
+    std::atomic<size_t> last_read_seq{0};    // Sequence number of the last message read by this subscriber
     size_t read_buffer_idx = 0;  // Index in the topic's ring buffer for this subscriber's next read
     // (İstersek thread_id, vs. eklenebilir)
 };
 
-template<typename T>
+// Topic başına abone kapasitesi MaxSubscribers ile verilir (varsayılan MREQ_MAX_SUBSCRIBERS).
+// Boş slotlar bir bitmap'te tutulur: subscribe() count-trailing-zeros ile slot bulur,
+// subscriber_count() O(1)'dir.
+template<typename T, size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS>
 class SubscriberTable {
-    std::array<SubscriberSlot, MREQ_MAX_SUBSCRIBERS> slots{};
+    static_assert(MaxSubscribers >= 1, "Abone kapasitesi en az 1 olmalı");
+    static constexpr size_t kWordBits = 32;
+    static constexpr size_t kWords = (MaxSubscribers + kWordBits - 1) / kWordBits;
+
+    std::array<SubscriberSlot, MaxSubscribers> slots{};
+    std::array<uint32_t, kWords> used_{};   // Dolu slotlar; sadece mtx altında yazılır
+    std::atomic<size_t> count_{0};
     mreq::Mutex mtx;
     using LockType = mreq::LockGuard<mreq::Mutex>;
 
+    // Son kelimede kapasite dışındaki bitler hiçbir zaman boş sayılmaz
+    static constexpr uint32_t word_mask(size_t w) noexcept {
+        const size_t bits = (w + 1 == kWords) ? MaxSubscribers - w * kWordBits : kWordBits;
+        return bits == kWordBits ? ~uint32_t{0} : ((uint32_t{1} << bits) - 1);
+    }
+
 public:
     // Abone olmak isteyen için slot ayır, token/id döndür
     std::optional<size_t> subscribe() {
         LockType lock(mtx);
-        for (size_t i = 0; i < slots.size(); ++i) {
-            if (!slots[i].active) {
-                slots[i].active = true;
-                // last_read_seq ve read_buffer_idx, Topic::subscribe() tarafından ayarlanacak
-                // böylece abone sadece abonelik sonrası yayınlanan mesajları okur.
-                slots[i].last_read_seq = 0;
-                slots[i].read_buffer_idx = 0;
-                return i;
-            }
+        for (size_t w = 0; w < kWords; ++w) {
+            const uint32_t free_bits = ~used_[w] & word_mask(w);
+            if (free_bits == 0) continue;
+
+            const size_t bit = static_cast<size_t>(__builtin_ctz(free_bits));
+            const size_t i = w * kWordBits + bit;
+            used_[w] |= uint32_t{1} << bit;
+            // last_read_seq ve read_buffer_idx, Topic::subscribe() tarafından ayarlanacak
+            // böylece abone sadece abonelik sonrası yayınlanan mesajları okur.
+            slots[i].last_read_seq.store(0, std::memory_order_relaxed);
+            slots[i].read_buffer_idx = 0;
+            slots[i].selective = false;
+            slots[i].active.store(true, std::memory_order_release);
+            count_.fetch_add(1, std::memory_order_relaxed);
+            return i;
         }
         // Hiç boş slot yoksa abone alınamaz
         return std::nullopt;
@@ -48,18 +73,28 @@ public:
     void unsubscribe(size_t idx) noexcept {
         LockType lock(mtx);
         if (idx < slots.size()) {
-            slots[idx].active = false;
-            slots[idx].last_read_seq = 0;
+            const uint32_t bit = uint32_t{1} << (idx % kWordBits);
+            if (used_[idx / kWordBits] & bit) {
+                used_[idx / kWordBits] &= ~bit;
+                count_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            slots[idx].active.store(false, std::memory_order_release);
+            slots[idx].last_read_seq.store(0, std::memory_order_relaxed);
             slots[idx].read_buffer_idx = 0;
+            slots[idx].selective = false;
         }
     }
+    // Token etkin bir abonelik mi
+    bool is_active(size_t idx) const noexcept {
+        return idx < slots.size() && slots[idx].active.load(std::memory_order_relaxed);
+    }
 
     // Abone için yeni veri olup olmadığını kontrol eder
     // current_topic_seq: Topic'in en son yayınladığı mesajın sequence numarası
-    bool check(size_t idx, size_t current_topic_seq) noexcept {
-        LockType lock(mtx);
-        if (idx < slots.size() && slots[idx].active) {
-            return slots[idx].last_read_seq < current_topic_seq;
+    // Wait-free: kilit almaz, sadece relaxed load + karşılaştırma yapar
+    bool check(size_t idx, size_t current_topic_seq) const noexcept {
+        if (idx < slots.size() && slots[idx].active.load(std::memory_order_relaxed)) {
+            return slots[idx].last_read_seq.load(std::memory_order_relaxed) < current_topic_seq;
         }
         return false;
     }
@@ -67,8 +102,8 @@ public:
     // Abonenin okuma sequence ve buffer indeksini günceller
     void update_read_state(size_t idx, size_t new_topic_seq, size_t new_buffer_idx) noexcept {
         LockType lock(mtx);
-        if (idx < slots.size() && slots[idx].active) {
-            slots[idx].last_read_seq = new_topic_seq;
+        if (idx < slots.size() && slots[idx].active.load(std::memory_order_relaxed)) {
+            slots[idx].last_read_seq.store(new_topic_seq, std::memory_order_relaxed);
             slots[idx].read_buffer_idx = new_buffer_idx;
         }
     }
@@ -79,10 +114,17 @@ public:
         return slots[idx];
     }
 
-    // (Slot sayısını ve durumlarını göstermek için ek)
+    const SubscriberSlot& get_slot(size_t idx) const noexcept {
+        return slots[idx];
+    }
+
+    // Toplam slot sayısı (aktif + boş)
+    static constexpr size_t capacity() noexcept {
+        return MaxSubscribers;
+    }
+
+    // Aktif abone sayısı; kilitsiz, O(1)
     size_t subscriber_count() const noexcept {
-        LockType lock(const_cast<mreq::Mutex&>(mtx)); // const_cast needed for const method
-        return std::count_if(slots.begin(), slots.end(),
-            [](const SubscriberSlot& s) { return s.active; });
+        return count_.load(std::memory_order_relaxed);
     }
 };
@@ -1,10 +1,17 @@
 #pragma once
 #include <optional>
 #include <array>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
 #include <cstdio> // For printf
 #include "subscriber_table.hpp"
+#include "mreq/clock.hpp"
 #include "mreq/mutex.hpp"
+#include "mreq/subscribe_options.hpp"
 #include "mreq/internal/LockGuard.hpp"
+#include "mreq/internal/TopicOps.hpp"
+#include "mreq/internal/TopicStats.hpp"
 
 // Define MREQ_ENABLE_LOGGING to enable basic logging hooks
 // #define MREQ_ENABLE_LOGGING
@@ -13,22 +20,291 @@ using Token = size_t;
 
 namespace mreq {
 
-template<typename T, size_t N = 1>
-class Topic {
+// MutexT: yazıcı kilidi; varsayılan platform kilidi (POSIX'te CMake MREQ_POSIX_MUTEX ile seçilir),
+// POSIX'te topic başına mreq::AdaptiveMutex ya da mreq::PriorityInheritMutex verilebilir
+template<typename T, size_t N = 1, size_t MaxSubscribers = MREQ_MAX_SUBSCRIBERS, typename MutexT = mreq::Mutex>
+class Topic : public internal::TopicOps<Topic<T, N, MaxSubscribers, MutexT>, T> {
 public:
     using value_type = T;
 private:
     static_assert(N >= 1, "Buffer boyutu en az 1 olmalı");
-    std::array<T, N> buffer_{};
-    size_t sequence_ = 0;
+    MREQ_CACHE_ALIGNED std::array<T, N> buffer_{};
+    // Yazıcıya ait alanlar. Sadece mtx_ altında yazılır; check() kilitsiz okuyabilsin diye atomik
+    MREQ_CACHE_ALIGNED std::atomic<size_t> sequence_{0};
     size_t head_ = 0;
-    mutable mreq::Mutex mtx_;
-    using LockType = mreq::LockGuard<mreq::Mutex>;
-    mutable SubscriberTable<T> subscribers_;
+    mutable MutexT mtx_;
+    using LockType = internal::StatsLockGuard<MutexT>;
+    mutable SubscriberTable<T, MaxSubscribers> subscribers_;
+
+    // SubscribeOptions durumu; pending_dropped dışındaki alanlar sadece slot.selective olan
+    // abonelerde okunur
+    struct Selection {
+        uint32_t decimation = 1;
+        uint32_t skip = 0;                        // Filtre: teslimden önce atlanacak eşleşme sayısı
+        uint64_t min_interval_ns = 0;
+        std::atomic<uint64_t> next_read_ns{0};   // Throttle: bu andan önce mesaj verilmez
+        MessageFilter filter{};
+        size_t pending_dropped = 0;               // Sıradaki teslimde bildirilecek kayıp (taşma, terk edilen loan)
+    };
+    mutable std::array<Selection, MaxSubscribers> selections_{};
+    internal::TopicListeners listeners_;
+    mutable internal::TopicStats<MaxSubscribers> stats_;
     
     // Metadata pointer for this topic instance
     const mreq_metadata* metadata_ = nullptr;
 
+    // mtx_ tutulurken çağrılır: head_'deki slotu yayınlanmış say
+    void commit_locked() {
+        head_ = (head_ + 1) % N;
+        const size_t seq = sequence_.load(std::memory_order_relaxed) + 1;
+        sequence_.store(seq, std::memory_order_release);
+        stats_.on_publish();
+        
+#ifdef MREQ_ENABLE_LOGGING
+        printf("TOPIC[%s]: Published seq=%zu\n", 
+               metadata_ ? metadata_->topic_name : "unknown", seq);
+#endif
+    }
+
+    // mtx_ tutulurken çağrılır: commit edilmeyen loan head_ slotunu bozmuş olabilir.
+    // Bu slottaki (en eski) mesajı henüz okumamış aboneler onu atlar; ring taşmasında olduğu
+    // gibi kayıp sıradaki okumada ReadInfo::dropped ile bildirilir.
+    void abandon_loan_locked() noexcept {
+        const size_t seq = sequence_.load(std::memory_order_relaxed);
+        if (seq < N) return; // Slot henüz hiç yayınlanmamış
+        const size_t lost_seq = seq - N + 1;   // Slotu bozulan mesaj
+        for (size_t i = 0; i < subscribers_.capacity(); ++i) {
+            SubscriberSlot& slot = subscribers_.get_slot(i);
+            const size_t last_read_seq = slot.last_read_seq.load(std::memory_order_relaxed);
+            if (!slot.active.load(std::memory_order_relaxed) || last_read_seq >= lost_seq) continue;
+
+            Selection& sel = selections_[i];
+            size_t pos = lost_seq;
+            if (slot.selective && sel.min_interval_ns != 0) {
+                // Throttle en güncel mesajı okur; atlanan mesajlar kayıp sayılmaz
+            } else if (slot.selective && !sel.filter) {
+                // Seyreltme: sadece lost_seq'e kadarki hedefler kaybolur
+                const size_t lost = (lost_seq - last_read_seq) / sel.decimation;
+                if (lost == 0) continue;
+                sel.pending_dropped += lost;
+                pos = last_read_seq + lost * sel.decimation;
+            } else {
+                sel.pending_dropped += lost_seq - last_read_seq;
+            }
+            slot.last_read_seq.store(pos, std::memory_order_relaxed);
+            slot.read_buffer_idx = (head_ + 1) % N;
+        }
+    }
+
+    // mtx_ tutulurken çağrılır: okuma konumunu pos sequence'ına taşır (seq - pos <= N)
+    void seek_locked(SubscriberSlot& slot, size_t seq, size_t pos) const noexcept {
+        slot.last_read_seq.store(pos, std::memory_order_relaxed);
+        slot.read_buffer_idx = (head_ + N - (seq - pos)) % N;
+    }
+
+    // Ring'de duran s sequence'lı mesajın indeksi
+    size_t index_of(size_t seq, size_t s) const noexcept {
+        return (head_ + N - 1 - (seq - s)) % N;
+    }
+
+    // mtx_ tutulurken çağrılır: seyreltilmiş/throttle edilen abonenin sıradaki mesajı.
+    // Aradaki mesajlar kopyalanmaz, last_read_seq doğrudan hedef mesaja taşınır.
+    const T* next_rate_limited_locked(Selection& sel, SubscriberSlot& slot, size_t seq,
+                                      size_t last_read_seq, ReadInfo& info) const noexcept {
+        const size_t step = sel.decimation;
+        size_t target = last_read_seq + step;
+        if (sel.min_interval_ns != 0) {
+            const uint64_t now = mreq::now_ns();
+            if (now < sel.next_read_ns.load(std::memory_order_relaxed)) return nullptr;
+            sel.next_read_ns.store(now + sel.min_interval_ns, std::memory_order_relaxed);
+            target = seq;   // En güncel mesaj
+        }
+        if (target > seq) return nullptr;
+
+        // Hedef ring'den düştüyse aynı adımla ring'deki ilk mesaja ilerle; düşen hedefler kaybolmuştur
+        size_t dropped = 0;
+        const size_t oldest = seq > N ? seq - N + 1 : 1;
+        if (target < oldest) {
+            dropped = (oldest - target + step - 1) / step;
+            target += dropped * step;
+            if (target > seq) {
+                // Kayıp, hedef yayınlanınca teslim edilen mesajla bildirilir
+                sel.pending_dropped += dropped;
+                slot.last_read_seq.store(target - step, std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+
+        seek_locked(slot, seq, target);
+        info.sequence = target;
+        info.dropped = sel.pending_dropped + dropped;
+        sel.pending_dropped = 0;
+        return &buffer_[index_of(seq, target)];
+    }
+
+    // mtx_ tutulurken çağrılır: filtreli abonenin sıradaki eşleşen mesajını ring'de yerinde
+    // arar; eşleşmeyenler kopyalanmadan geçilir. consume == false (check()) ise mesaj
+    // tüketilmez, okuma konumu sadece eşleşmenin önüne taşınır.
+    const T* next_filtered_locked(Selection& sel, SubscriberSlot& slot, size_t seq,
+                                  size_t last_read_seq, ReadInfo& info, bool consume) const noexcept {
+        uint64_t now = 0;
+        if (sel.min_interval_ns != 0) {
+            now = mreq::now_ns();
+            if (now < sel.next_read_ns.load(std::memory_order_relaxed)) return nullptr;
+        }
+
+        // Değerlendirilemeden ring'den düşen mesajlar; throttle'da zaten atlanacaklardı
+        const size_t oldest = seq > N ? seq - N + 1 : 1;
+        if (last_read_seq + 1 < oldest) {
+            if (sel.min_interval_ns == 0) sel.pending_dropped += oldest - 1 - last_read_seq;
+            last_read_seq = oldest - 1;
+        }
+
+        size_t found = 0;
+        if (sel.min_interval_ns != 0) {
+            // Throttle: en güncel eşleşen mesaj
+            size_t idx = index_of(seq, seq);
+            for (size_t s = seq; s > last_read_seq; --s) {
+                if (sel.filter(&buffer_[idx])) {
+                    found = s;
+                    break;
+                }
+                idx = idx == 0 ? N - 1 : idx - 1;
+            }
+        } else {
+            size_t idx = index_of(seq, last_read_seq + 1);
+            for (size_t s = last_read_seq + 1; s <= seq; ++s, idx = idx + 1 == N ? 0 : idx + 1) {
+                if (!sel.filter(&buffer_[idx])) continue;
+                if (sel.skip == 0) {
+                    found = s;
+                    break;
+                }
+                --sel.skip;
+            }
+        }
+        if (found == 0) {
+            seek_locked(slot, seq, seq);
+            return nullptr;
+        }
+        if (!consume) {
+            seek_locked(slot, seq, found - 1);
+            return &buffer_[index_of(seq, found)];
+        }
+
+        seek_locked(slot, seq, found);
+        if (sel.min_interval_ns != 0) {
+            sel.next_read_ns.store(now + sel.min_interval_ns, std::memory_order_relaxed);
+        }
+        sel.skip = sel.decimation - 1;
+        info.sequence = found;
+        info.dropped = sel.pending_dropped;
+        sel.pending_dropped = 0;
+        return &buffer_[index_of(seq, found)];
+    }
+
+    // mtx_ tutulurken çağrılır: abonenin sıradaki mesajını bulur ve okuma durumunu ilerletir.
+    // Abone geride kaldıysa ring'deki en eski mesaja atlar; atlananlar info.dropped'a yazılır.
+    const T* next_message_locked(Token token, ReadInfo& info) const noexcept {
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        const size_t seq = sequence_.load(std::memory_order_relaxed);
+        size_t last_read_seq = slot.last_read_seq.load(std::memory_order_relaxed);
+
+        if (slot.active.load(std::memory_order_relaxed) && last_read_seq < seq) {
+            if (slot.selective) {
+                Selection& sel = selections_[token];
+                if (sel.filter) return next_filtered_locked(sel, slot, seq, last_read_seq, info, true);
+                return next_rate_limited_locked(sel, slot, seq, last_read_seq, info);
+            }
+            size_t read_idx = slot.read_buffer_idx;
+            
+            size_t dropped = 0;
+            
+            if ((seq - last_read_seq) > N) {
+                read_idx = head_;
+                dropped = seq - N - last_read_seq;
+                last_read_seq = seq - N;
+            }
+
+            Selection& sel = selections_[token];
+            slot.last_read_seq.store(last_read_seq + 1, std::memory_order_relaxed);
+            slot.read_buffer_idx = (read_idx + 1) % N;
+            info.sequence = last_read_seq + 1;
+            info.dropped = sel.pending_dropped + dropped;
+            sel.pending_dropped = 0;
+            return &buffer_[read_idx];
+        }
+        return nullptr;
+    }
+
+    // mtx_ tutulurken çağrılır: abonenin okunmamış mesajlarından en fazla max_count tanesini
+    // tüketir ve ring'deki başlangıç indeksini döndürür. Geride kalan abone en eskiye atlar.
+    size_t claim_range_locked(Token token, size_t max_count, size_t& count,
+                              ReadInfo& info) const noexcept {
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        const size_t seq = sequence_.load(std::memory_order_relaxed);
+        size_t last_read_seq = slot.last_read_seq.load(std::memory_order_relaxed);
+        info.dropped = 0;
+        count = 0;
+        if (!slot.active.load(std::memory_order_relaxed) || last_read_seq >= seq) return 0;
+
+        size_t start = slot.read_buffer_idx;
+        if ((seq - last_read_seq) > N) {
+            start = head_;
+            info.dropped = seq - N - last_read_seq;
+            last_read_seq = seq - N;
+        }
+        count = std::min(max_count, seq - last_read_seq);
+        if (count == 0) return 0;
+
+        Selection& sel = selections_[token];
+        info.dropped += sel.pending_dropped;
+        sel.pending_dropped = 0;
+        last_read_seq += count;
+        slot.last_read_seq.store(last_read_seq, std::memory_order_relaxed);
+        slot.read_buffer_idx = (start + count) % N;
+        info.sequence = last_read_seq;
+        return start;
+    }
+
+    // Kilitsiz: seçici abonenin okunabilir mesajı olabilir mi. Filtreli abonelikte kesin
+    // cevap için mesajların değerlendirilmesi gerekir, bkz. filter_check()
+    bool selection_check(const Selection& sel, const SubscriberSlot& slot, size_t seq) const noexcept {
+        if (sel.min_interval_ns != 0) {
+            return mreq::now_ns() >= sel.next_read_ns.load(std::memory_order_relaxed);
+        }
+        if (sel.filter) return true;
+        return slot.last_read_seq.load(std::memory_order_relaxed) + sel.decimation <= seq;
+    }
+
+    // Filtreli abonenin okunmamış mesajlarını kilit altında değerlendirir. Eşleşmeyenler
+    // tüketilir; böylece sonraki check()/read() onları tekrar değerlendirmez.
+    bool filter_check(Selection& sel, SubscriberSlot& slot) const noexcept {
+        LockType lock(mtx_, stats_);
+        const size_t seq = sequence_.load(std::memory_order_relaxed);
+        const size_t last_read_seq = slot.last_read_seq.load(std::memory_order_relaxed);
+        if (!slot.active.load(std::memory_order_relaxed) || last_read_seq >= seq) return false;
+        ReadInfo unused;
+        return next_filtered_locked(sel, slot, seq, last_read_seq, unused, false) != nullptr;
+    }
+
+    // mtx_ tutulurken çağrılır: seçici abonenin teslim edilen mesajlarını tek tek kopyalar
+    size_t read_multiple_selective_locked(Token token, T* out_buffer, size_t count,
+                                             ReadInfo& info) const {
+        size_t messages_read = 0;
+        size_t dropped = 0;
+        ReadInfo step_info;
+        while (messages_read < count) {
+            const T* msg = next_message_locked(token, step_info);
+            if (!msg) break;
+            out_buffer[messages_read++] = *msg;
+            dropped += step_info.dropped;
+            info.sequence = step_info.sequence;
+        }
+        info.dropped = dropped;
+        if (messages_read) stats_.on_read(token, messages_read, dropped);
+        return messages_read;
+    }
+
 public:
     // Constructor with metadata binding
     explicit Topic(const mreq_metadata* metadata = nullptr) : metadata_(metadata) {}
@@ -42,111 +318,311 @@ public:
         return metadata_;
     }
     
+    // Publisher'ın mesajı doğrudan ring slotunda oluşturması için ödünç alma (zero-copy).
+    // Loan yaşadığı sürece topic kilidi tutulur; commit() ile yayınlanır.
+    // commit() edilmeden yok edilirse slottaki en eski mesaj düşürülür.
+    class Loan {
+    public:
+        Loan(Loan&& other) noexcept : topic_(other.topic_) { other.topic_ = nullptr; }
+        Loan(const Loan&) = delete;
+        Loan& operator=(const Loan&) = delete;
+        Loan& operator=(Loan&&) = delete;
+        ~Loan() {
+            if (topic_) {
+                topic_->abandon_loan_locked();
+                topic_->mtx_.unlock();
+            }
+        }
+
+        T& get() noexcept { return topic_->buffer_[topic_->head_]; }
+        T& operator*() noexcept { return get(); }
+        T* operator->() noexcept { return &get(); }
+
+        void commit() {
+            if (!topic_) return;
+            topic_->commit_locked();
+            topic_->mtx_.unlock();
+            topic_->listeners_.notify();
+            topic_ = nullptr;
+        }
+
+    private:
+        friend class Topic;
+        explicit Loan(Topic* topic) : topic_(topic) { topic_->stats_.lock(topic_->mtx_); }
+        Topic* topic_;
+    };
+
+    // Abonenin sıradaki mesajına kopyasız, salt-okunur erişim.
+    // View yaşadığı sürece topic kilidi tutulur, mesaj üzerine yazılamaz; kısa tutulmalıdır.
+    class ReadView {
+    public:
+        ReadView(ReadView&& other) noexcept : topic_(other.topic_), msg_(other.msg_) {
+            other.topic_ = nullptr;
+            other.msg_ = nullptr;
+        }
+        ReadView(const ReadView&) = delete;
+        ReadView& operator=(const ReadView&) = delete;
+        ReadView& operator=(ReadView&&) = delete;
+        ~ReadView() { release(); }
+
+        explicit operator bool() const noexcept { return msg_ != nullptr; }
+        const T& get() const noexcept { return *msg_; }
+        const T& operator*() const noexcept { return *msg_; }
+        const T* operator->() const noexcept { return msg_; }
+
+        void release() noexcept {
+            if (topic_) {
+                topic_->mtx_.unlock();
+                topic_ = nullptr;
+            }
+            msg_ = nullptr;
+        }
+
+    private:
+        friend class Topic;
+        ReadView(const Topic* topic, const T* msg) : topic_(topic), msg_(msg) {}
+        const Topic* topic_;
+        const T* msg_;
+    };
+
+    // Ring içinde bitişik, salt-okunur mesaj dizisi
+    struct Span {
+        const T* data = nullptr;
+        size_t size = 0;
+
+        const T* begin() const noexcept { return data; }
+        const T* end() const noexcept { return data + size; }
+        bool empty() const noexcept { return size == 0; }
+    };
+
+    // Abonenin okunmamış tüm mesajlarına kopyasız erişim: ring sarması nedeniyle en fazla iki span.
+    // first() eski, second() yeni mesajları içerir. Nesne yaşadığı sürece topic kilidi tutulur.
+    class ReadSpans {
+    public:
+        ReadSpans(ReadSpans&& other) noexcept
+            : topic_(other.topic_), first_(other.first_), second_(other.second_) {
+            other.topic_ = nullptr;
+            other.first_ = {};
+            other.second_ = {};
+        }
+        ReadSpans(const ReadSpans&) = delete;
+        ReadSpans& operator=(const ReadSpans&) = delete;
+        ReadSpans& operator=(ReadSpans&&) = delete;
+        ~ReadSpans() { release(); }
+
+        explicit operator bool() const noexcept { return first_.size != 0; }
+        size_t size() const noexcept { return first_.size + second_.size; }
+        const Span& first() const noexcept { return first_; }
+        const Span& second() const noexcept { return second_; }
+
+        void release() noexcept {
+            if (topic_) {
+                topic_->mtx_.unlock();
+                topic_ = nullptr;
+            }
+            first_ = {};
+            second_ = {};
+        }
+
+    private:
+        friend class Topic;
+        ReadSpans(const Topic* topic, Span first, Span second)
+            : topic_(topic), first_(first), second_(second) {}
+        const Topic* topic_;
+        Span first_;
+        Span second_;
+    };
+
     // All your existing methods remain the same
     void publish(const T& msg) {
-        LockType lock(mtx_);
-        buffer_[head_] = msg;
-        head_ = (head_ + 1) % N;
-        ++sequence_;
-        
+        {
+            LockType lock(mtx_, stats_);
+            buffer_[head_] = msg;
+            commit_locked();
+        }
+        listeners_.notify();
+    }
+
+    // Burst yayınlama: tek kilit, ring sonunda en fazla iki bitişik kopya, sequence_ bir kez ilerler.
+    // count > N ise sadece son N mesaj ring'de kalır (öncekiler abonelerce kaçırılmış sayılır).
+    void publish_multiple(const T* msgs, size_t count) {
+        if (count == 0) return;
+        {
+            LockType lock(mtx_, stats_);
+            const size_t kept = count < N ? count : N;
+            const T* src = msgs + (count - kept);
+            const size_t start = (head_ + (count - kept)) % N;
+            const size_t first = std::min(kept, N - start);
+
+            std::copy(src, src + first, buffer_.begin() + start);
+            std::copy(src + first, src + kept, buffer_.begin());
+
+            head_ = (head_ + count) % N;
+            const size_t seq = sequence_.load(std::memory_order_relaxed) + count;
+            sequence_.store(seq, std::memory_order_release);
+            stats_.on_publish(count);
+
 #ifdef MREQ_ENABLE_LOGGING
-        printf("TOPIC[%s]: Published seq=%zu\n", 
-               metadata_ ? metadata_->topic_name : "unknown", sequence_);
+            printf("TOPIC[%s]: Published %zu messages, seq=%zu\n",
+                   metadata_ ? metadata_->topic_name : "unknown", count, seq);
 #endif
+        }
+        listeners_.notify();
+    }
+
+    Loan loan() {
+        return Loan(this);
     }
 
-    std::optional<Token> subscribe() {
-        LockType lock(mtx_);
+    // options: her N. mesaj, aralık başına en fazla bir (en güncel) mesaj ve/veya sadece
+    // filtreyi sağlayan mesajlar; teslim edilmeyen mesajlar kopyalanmaz. Bkz. SubscribeOptions.
+    // Filtre başka bir mesaj tipi için kurulduysa ya da platformda saat yokken (bare metal,
+    // MREQ_BAREMETAL_NOW_NS tanımsız) throttle istenirse std::nullopt döner.
+    std::optional<Token> subscribe(const SubscribeOptions& options = {}) {
+        if (options.filter && options.filter.type != internal::type_tag<T>()) return std::nullopt;
+        if (options.min_interval_ns != 0 && !mreq::kHasClock) return std::nullopt;
+        LockType lock(mtx_, stats_);
         std::optional<Token> token_opt = subscribers_.subscribe();
         if (token_opt.has_value()) {
             Token token = token_opt.value();
-            size_t initial_read_idx = (sequence_ < N) ? 0 : head_;
-            subscribers_.update_read_state(token, sequence_, initial_read_idx);
+            // Throttle decimation'dan önceliklidir
+            Selection& sel = selections_[token];
+            sel.decimation = (options.decimation > 1 && options.min_interval_ns == 0) ? options.decimation : 1;
+            sel.skip = sel.decimation - 1;
+            sel.min_interval_ns = options.min_interval_ns;
+            sel.next_read_ns.store(0, std::memory_order_relaxed);
+            sel.filter = options.filter;
+            sel.pending_dropped = 0;
+            subscribers_.get_slot(token).selective =
+                sel.decimation > 1 || sel.min_interval_ns > 0 || static_cast<bool>(sel.filter);
+            stats_.on_subscribe(token);
+            const size_t seq = sequence_.load(std::memory_order_relaxed);
+            subscribers_.update_read_state(token, seq, head_);
         }
         return token_opt;
     }
 
     std::optional<T> read(Token token) const {
-        LockType lock(mtx_);
-        SubscriberSlot& slot = subscribers_.get_slot(token);
-
-        if (slot.active && slot.last_read_seq < sequence_) {
-            size_t read_idx = slot.read_buffer_idx;
-            
-            if (N > 1 && (sequence_ - slot.last_read_seq) > N) {
-                read_idx = head_;
-                slot.last_read_seq = sequence_ - N;
-            }
+        ReadInfo info;
+        return read(token, info);
+    }
 
-            T msg_to_return = buffer_[read_idx];
-            slot.last_read_seq++;
-            slot.read_buffer_idx = (read_idx + 1) % N;
-            
-            return msg_to_return;
+    // Mesajla birlikte sequence numarasını ve öncesinde kaçırılan mesaj sayısını döndürür
+    std::optional<T> read(Token token, ReadInfo& info) const {
+        LockType lock(mtx_, stats_);
+        const T* msg = next_message_locked(token, info);
+        if (msg) {
+            stats_.on_read(token, 1, info.dropped);
+            return *msg;
         }
         return std::nullopt;
     }
 
+    ReadView read_view(Token token) const {
+        ReadInfo info;
+        return read_view(token, info);
+    }
+
+    ReadView read_view(Token token, ReadInfo& info) const {
+        stats_.lock(mtx_);
+        const T* msg = next_message_locked(token, info);
+        if (!msg) {
+            mtx_.unlock();
+            return ReadView(nullptr, nullptr);
+        }
+        stats_.on_read(token, 1, info.dropped);
+        return ReadView(this, msg);
+    }
+
     size_t read_multiple(Token token, T* out_buffer, size_t count) const {
-        LockType lock(mtx_);
+        ReadInfo info;
+        return read_multiple(token, out_buffer, count, info);
+    }
+
+    // info.sequence: son okunan mesaj, info.dropped: bu çağrıda atlanan toplam mesaj.
+    // Ring sarması noktasında bölünen en fazla iki toplu kopya yapılır.
+    size_t read_multiple(Token token, T* out_buffer, size_t count, ReadInfo& info) const {
+        LockType lock(mtx_, stats_);
         SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (slot.selective) return read_multiple_selective_locked(token, out_buffer, count, info);
         size_t messages_read = 0;
+        const size_t start = claim_range_locked(token, count, messages_read, info);
+        if (messages_read == 0) return 0;
 
-        if (!slot.active) return 0;
+        const size_t first = std::min(messages_read, N - start);
+        std::copy(buffer_.begin() + start, buffer_.begin() + start + first, out_buffer);
+        std::copy(buffer_.begin(), buffer_.begin() + (messages_read - first), out_buffer + first);
+        stats_.on_read(token, messages_read, info.dropped);
 
-        for (size_t i = 0; i < count && slot.last_read_seq < sequence_; ++i) {
-            size_t read_idx = slot.read_buffer_idx;
-            
-            if (N > 1 && (sequence_ - slot.last_read_seq) > N) {
-                read_idx = head_;
-                slot.last_read_seq = sequence_ - N;
-            }
+        return messages_read;
+    }
 
-            out_buffer[messages_read++] = buffer_[read_idx];
-            slot.last_read_seq++;
-            slot.read_buffer_idx = (read_idx + 1) % N;
+    ReadSpans read_spans(Token token) const {
+        ReadInfo info;
+        return read_spans(token, info);
+    }
+
+    // Okunmamış tüm mesajları tek seferde tüketir; info.sequence son mesajın sequence'ıdır.
+    // Seyreltilmiş/throttle edilen abonelikte mesajlar bitişik olmadığından tek mesaj verilir.
+    ReadSpans read_spans(Token token, ReadInfo& info) const {
+        stats_.lock(mtx_);
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (slot.selective) {
+            const T* msg = next_message_locked(token, info);
+            if (!msg) {
+                mtx_.unlock();
+                return ReadSpans(nullptr, {}, {});
+            }
+            stats_.on_read(token, 1, info.dropped);
+            return ReadSpans(this, {msg, 1}, {});
         }
-        
-        return messages_read;
+        size_t count = 0;
+        const size_t start = claim_range_locked(token, N, count, info);
+        if (count == 0) {
+            mtx_.unlock();
+            return ReadSpans(nullptr, {}, {});
+        }
+        stats_.on_read(token, count, info.dropped);
+        const size_t first = std::min(count, N - start);
+        return ReadSpans(this, {&buffer_[start], first}, {buffer_.data(), count - first});
     }
 
     void unsubscribe(Token token) noexcept {
         subscribers_.unsubscribe(token);
     }
 
-    bool check(Token token) const noexcept {
-        LockType lock(mtx_);
-        return subscribers_.check(token, sequence_);
+    // Her publish sonrası (kilit bırakıldıktan sonra) listener'lar bilgilendirilir
+    bool attach_listener(const internal::TopicListener* listener) noexcept {
+        return listeners_.attach(listener);
     }
 
-    // Static functions for metadata function pointers
-    static std::optional<Token> static_subscribe(void* topic_ptr) {
-        return static_cast<Topic<T, N>*>(topic_ptr)->subscribe();
+    void detach_listener(const internal::TopicListener* listener) noexcept {
+        listeners_.detach(listener);
     }
-    
-    static void static_unsubscribe(void* topic_ptr, Token token) {
-        static_cast<Topic<T, N>*>(topic_ptr)->unsubscribe(token);
-    }
-    
-    static bool static_check(void* topic_ptr, Token token) {
-        return static_cast<Topic<T, N>*>(topic_ptr)->check(token);
-    }
-    
-    static void static_publish(void* topic_ptr, const void* data) {
-        static_cast<Topic<T, N>*>(topic_ptr)->publish(*static_cast<const T*>(data));
+
+    void stats(TopicStatsSnapshot& out) const noexcept {
+        out.topic_name = metadata_ ? metadata_->topic_name : nullptr;
+        internal::fill_subscriber_lag(subscribers_, sequence_.load(std::memory_order_acquire), out);
+        stats_.fill(out);
     }
-    
-    static void* static_read(void* topic_ptr, Token token, void* result) {
-        auto opt_result = static_cast<Topic<T, N>*>(topic_ptr)->read(token);
-        if (opt_result.has_value()) {
-            *static_cast<T*>(result) = *opt_result;
-            return result;
-        }
-        return nullptr;
+
+    // Token etkin bir abonelik mi (unsubscribe edilmemiş)
+    bool subscribed(Token token) const noexcept {
+        return subscribers_.is_active(token);
     }
-    
-    static size_t static_read_multiple(void* topic_ptr, Token token, void* buffer, size_t count) {
-        return static_cast<Topic<T, N>*>(topic_ptr)->read_multiple(token, static_cast<T*>(buffer), count);
+
+    // Kilitsiz: tek bir acquire load + karşılaştırma
+    // Seyreltilmiş abone sıradaki hedef mesaj yayınlanana, throttle edilen abone aralık
+    // dolana kadar false alır. Filtreli abonede okunmamış mesaj varsa bunlar kilit altında
+    // yerinde değerlendirilir ve eşleşen yoksa false döner.
+    bool check(Token token) const noexcept {
+        const size_t seq = sequence_.load(std::memory_order_acquire);
+        if (!subscribers_.check(token, seq)) return false;
+        SubscriberSlot& slot = subscribers_.get_slot(token);
+        if (!slot.selective) return true;
+        Selection& sel = selections_[token];
+        if (!selection_check(sel, slot, seq)) return false;
+        return !sel.filter || filter_check(sel, slot);
     }
 };
 
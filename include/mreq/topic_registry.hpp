@@ -6,9 +6,14 @@
 #include <type_traits>
 #include <cassert>
 #include <any>
+#include <atomic>
+#include <cstdio>
 #include "mutex.hpp"
 #include "topic.hpp"
+#include "seqlock_topic.hpp"
+#include "multi_producer_topic.hpp"
 #include "metadata.hpp"
+#include "perfect_hash.hpp"
 #include "internal/LockGuard.hpp"
 #include "internal/NonCopyable.hpp"
 
@@ -18,142 +23,203 @@
 
 namespace mreq {
 
+namespace internal {
+// Registry tablo boyutu (bit): en az 2 * max_topics olan 2'nin kuvveti (yük faktörü <= %50)
+constexpr unsigned registry_table_bits(size_t max_topics) noexcept {
+    unsigned bits = 1;
+    while ((size_t{1} << bits) < 2 * max_topics) ++bits;
+    return bits;
+}
+} // namespace internal
+
+// Açık adreslemeli (linear probing), sadece-ekleme yapılan topic registry.
+// Her girdi tek bir release store ile yayınlanır ve bir daha değişmez; bu yüzden
+// lookup'lar kilitsizdir ve register_topic ile eşzamanlı çağrılabilir (RCU benzeri:
+// okuyucular her zaman tutarlı bir anlık görüntü görür, serbest bırakılacak eski
+// sürüm olmadığı için grace period gerekmez). Başlangıçtan sonra da kayıt yapılabilir.
 class TopicRegistry : private internal::NonCopyable {
 private:
-    // Use message_id for ultra-fast comparison instead of pointer comparison
-    std::array<size_t, MREQ_MAX_TOPICS> message_ids_{};           // 8 bytes per entry
-    std::array<const mreq_metadata*, MREQ_MAX_TOPICS> metadata_ptrs_{}; // 8 bytes per entry  
-    uint8_t topic_count_ = 0;                                      // 1 byte
-    mutable mreq::Mutex mtx_{};                                    // Platform specific
-    
+    static constexpr unsigned kTableBits = internal::registry_table_bits(MREQ_MAX_TOPICS);
+    static constexpr size_t kTableSize = size_t{1} << kTableBits;
+    static constexpr size_t kTableMask = kTableSize - 1;
+    static_assert(kTableBits <= 32, "MREQ_MAX_TOPICS çok büyük");
+
+    std::array<std::atomic<const mreq_metadata*>, kTableSize> table_{};          // message_id -> metadata
+    std::array<std::atomic<const mreq_metadata*>, MREQ_MAX_TOPICS> by_index_{};  // Kayıt sırası
+    std::atomic<size_t> topic_count_{0};
+    mutable mreq::Mutex mtx_{};                                                  // Sadece yazıcılar için
+
     TopicRegistry() = default;
 
+    static size_t home_slot(size_t message_id) noexcept {
+        // Fibonacci hashing: djb2'nin zayıf alt bitlerini karıştırır
+        return perfect_hash_slot(message_id, 0x9E3779B1u, 32 - kTableBits);
+    }
+
 public:
     static TopicRegistry& instance() noexcept {
         static TopicRegistry inst;
         return inst;
     }
     
-    // ULTRA-FAST: Hot path - inline for maximum performance
-    // O(1) average case with small linear search for embedded systems
-    inline const mreq_metadata* find_by_id(size_t message_id) noexcept {
-        // Fast path: try without lock first (read-only access)
-        // Safe if registry is populated during initialization phase
-        for (uint8_t i = 0; i < topic_count_; ++i) {
-            if (message_ids_[i] == message_id) {
-                return metadata_ptrs_[i];
-            }
+    // Kilitsiz, O(1) ortalama: boş slota ya da eşleşen ID'ye kadar linear probing
+    inline const mreq_metadata* find_by_id(size_t message_id) const noexcept {
+        for (size_t i = home_slot(message_id), probes = 0; probes < kTableSize;
+             i = (i + 1) & kTableMask, ++probes) {
+            const mreq_metadata* entry = table_[i].load(std::memory_order_acquire);
+            if (!entry) return nullptr;
+            if (entry->message_id == message_id) return entry;
         }
         return nullptr;
     }
     
-    // Legacy support: find by metadata pointer (slower)
-    inline const mreq_metadata* find_by_metadata_ptr(const mreq_metadata* metadata_ptr) noexcept {
+    // Legacy support: find by metadata pointer (ID üzerinden O(1))
+    inline const mreq_metadata* find_by_metadata_ptr(const mreq_metadata* metadata_ptr) const noexcept {
         if (!metadata_ptr) return nullptr;
-        
-        for (uint8_t i = 0; i < topic_count_; ++i) {
-            if (metadata_ptrs_[i] == metadata_ptr) {
-                return metadata_ptrs_[i];
-            }
-        }
-        return nullptr;
+        const mreq_metadata* entry = find_by_id(metadata_ptr->message_id);
+        return entry == metadata_ptr ? entry : nullptr;
     }
     
-    // Thread-safe registration (called during initialization)
+    // Thread-safe registration; okuyucularla eşzamanlı çağrılabilir
     bool register_topic(const mreq_metadata* metadata) noexcept {
         if (!metadata) return false;
         
         mreq::LockGuard<mreq::Mutex> lock(mtx_);
         
-        if (topic_count_ >= MREQ_MAX_TOPICS) {
+        const size_t count = topic_count_.load(std::memory_order_relaxed);
+        if (count >= MREQ_MAX_TOPICS) {
             return false; // Registry full
         }
         
-        // Check for duplicate message_id (much faster than pointer comparison)
-        size_t new_id = metadata->message_id;
-        for (uint8_t i = 0; i < topic_count_; ++i) {
-            if (message_ids_[i] == new_id) {
+        const size_t new_id = metadata->message_id;
+        size_t i = home_slot(new_id);
+        for (;;) {
+            const mreq_metadata* entry = table_[i].load(std::memory_order_relaxed);
+            if (!entry) break;
+            if (entry->message_id == new_id) {
                 return false; // Duplicate ID
             }
+            i = (i + 1) & kTableMask; // Yük faktörü <= %50 olduğu için boş slot vardır
         }
         
-        // Add new entry
-        message_ids_[topic_count_] = new_id;
-        metadata_ptrs_[topic_count_] = metadata;
-        ++topic_count_;
+        // Önce sıralı dizi, sonra sayaç ve hash tablosu yayınlanır
+        by_index_[count].store(metadata, std::memory_order_relaxed);
+        topic_count_.store(count + 1, std::memory_order_release);
+        table_[i].store(metadata, std::memory_order_release);
         
 #ifdef MREQ_ENABLE_LOGGING
-        printf("REGISTRY: Registered topic '%s' (ID: %zu) at index %u\n", 
-               metadata->topic_name, new_id, topic_count_ - 1);
+        printf("REGISTRY: Registered topic '%s' (ID: %zu) at index %zu\n", 
+               metadata->topic_name, new_id, count);
 #endif
         
         return true;
     }
     
     // Utility functions
-    inline uint8_t size() const noexcept { 
-        return topic_count_; 
+    inline size_t size() const noexcept { 
+        return topic_count_.load(std::memory_order_acquire); 
+    }
+    
+    static constexpr size_t capacity() noexcept {
+        return MREQ_MAX_TOPICS;
     }
     
     inline bool full() const noexcept { 
-        return topic_count_ >= MREQ_MAX_TOPICS; 
+        return size() >= MREQ_MAX_TOPICS; 
     }
     
     inline bool empty() const noexcept {
-        return topic_count_ == 0;
+        return size() == 0;
     }
     
     // Get all registered topics (for diagnostics/monitoring)
-    uint8_t get_all_topics(const mreq_metadata** out_array, uint8_t max_count) const noexcept {
-        mreq::LockGuard<mreq::Mutex> lock(mtx_);
-        
-        uint8_t copy_count = (topic_count_ < max_count) ? topic_count_ : max_count;
-        for (uint8_t i = 0; i < copy_count; ++i) {
-            out_array[i] = metadata_ptrs_[i];
+    size_t get_all_topics(const mreq_metadata** out_array, size_t max_count) const noexcept {
+        const size_t count = size();
+        const size_t copy_count = (count < max_count) ? count : max_count;
+        for (size_t i = 0; i < copy_count; ++i) {
+            out_array[i] = by_index_[i].load(std::memory_order_relaxed);
         }
         return copy_count;
     }
     
+    // Bir topic'in istatistik görüntüsü (izleme: sıcak topic'ler, geride kalan aboneler)
+    bool get_stats(size_t message_id, TopicStatsSnapshot& out) const noexcept {
+        const mreq_metadata* metadata = find_by_id(message_id);
+        return metadata && metadata->stats(out);
+    }
+    
+    // Fonksiyon tablosu olan tüm topic'lerin istatistikleri, kayıt sırasıyla
+    size_t get_all_stats(TopicStatsSnapshot* out_array, size_t max_count) const noexcept {
+        const size_t count = size();
+        size_t written = 0;
+        for (size_t i = 0; i < count && written < max_count; ++i) {
+            const mreq_metadata* entry = by_index_[i].load(std::memory_order_relaxed);
+            if (entry->stats(out_array[written])) {
+                ++written;
+            }
+        }
+        return written;
+    }
+    
     // Get topic by index (for iteration)
-    const mreq_metadata* get_topic_by_index(uint8_t index) const noexcept {
-        if (index < topic_count_) {
-            return metadata_ptrs_[index];
+    const mreq_metadata* get_topic_by_index(size_t index) const noexcept {
+        if (index < size()) {
+            return by_index_[index].load(std::memory_order_relaxed);
         }
         return nullptr;
     }
     
-    // For debugging/testing - use with caution in production
+    // For debugging/testing - eşzamanlı lookup'larla birlikte çağrılmamalı
     void clear() noexcept {
         mreq::LockGuard<mreq::Mutex> lock(mtx_);
         
-        topic_count_ = 0;
-        message_ids_.fill(0);
-        metadata_ptrs_.fill(nullptr);
+        topic_count_.store(0, std::memory_order_release);
+        for (auto& entry : table_) entry.store(nullptr, std::memory_order_relaxed);
+        for (auto& entry : by_index_) entry.store(nullptr, std::memory_order_relaxed);
         
 #ifdef MREQ_ENABLE_LOGGING
         printf("REGISTRY: All topics cleared\n");
 #endif
     }
     
+    // For debugging/testing - sadece ilk count kaydı bırakır, hash tablosu bunlardan yeniden
+    // kurulur (linear probing zincirleri bozulmasın diye). clear() gibi eşzamanlı lookup'larla
+    // birlikte çağrılmamalı
+    void truncate(size_t count) noexcept {
+        mreq::LockGuard<mreq::Mutex> lock(mtx_);
+
+        const size_t current = topic_count_.load(std::memory_order_relaxed);
+        if (count >= current) return;
+        for (size_t i = count; i < current; ++i) by_index_[i].store(nullptr, std::memory_order_relaxed);
+        for (auto& entry : table_) entry.store(nullptr, std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            const mreq_metadata* metadata = by_index_[i].load(std::memory_order_relaxed);
+            size_t slot = home_slot(metadata->message_id);
+            while (table_[slot].load(std::memory_order_relaxed)) slot = (slot + 1) & kTableMask;
+            table_[slot].store(metadata, std::memory_order_release);
+        }
+        topic_count_.store(count, std::memory_order_release);
+    }
+
     // Memory usage diagnostics
     size_t get_memory_usage() const noexcept {
-        return sizeof(TopicRegistry) + (topic_count_ * (sizeof(size_t) + sizeof(void*)));
+        return sizeof(TopicRegistry);
     }
     
     // Performance diagnostics
     void print_diagnostics() const noexcept {
 #ifdef MREQ_ENABLE_LOGGING
-        mreq::LockGuard<mreq::Mutex> lock(mtx_);
+        const size_t count = size();
         
         printf("=== TOPIC REGISTRY DIAGNOSTICS ===\n");
-        printf("Total topics: %u/%u\n", topic_count_, MREQ_MAX_TOPICS);
+        printf("Total topics: %zu/%u\n", count, static_cast<unsigned>(MREQ_MAX_TOPICS));
         printf("Memory usage: %zu bytes\n", get_memory_usage());
-        printf("Load factor: %.1f%%\n", (topic_count_ * 100.0f) / MREQ_MAX_TOPICS);
+        printf("Load factor: %.1f%%\n", (count * 100.0f) / kTableSize);
         
-        for (uint8_t i = 0; i < topic_count_; ++i) {
-            printf("  [%u] ID: %zu, Name: '%s'\n", 
-                   i, message_ids_[i], 
-                   metadata_ptrs_[i] ? metadata_ptrs_[i]->topic_name : "unknown");
+        for (size_t i = 0; i < count; ++i) {
+            const mreq_metadata* entry = by_index_[i].load(std::memory_order_relaxed);
+            printf("  [%zu] ID: %zu, Name: '%s'\n", 
+                   i, entry->message_id, entry->topic_name);
         }
         printf("=================================\n");
 #endif
@@ -177,11 +243,13 @@ inline bool register_topic_metadata(const mreq_metadata* metadata) noexcept {
 
 } // namespace mreq
 
-#define MREQ_TOPIC_DECLARE(MSGTYPE, NAME, BUFFER_SIZE) \
-    extern mreq::Topic<MSGTYPE, BUFFER_SIZE> NAME##_topic_instance;
+// Herhangi bir topic sınıfı ile tanımlama (örn: mreq::SeqlockTopic<MSGTYPE, 8>)
+// Topic tipi virgül içerebildiği için son (variadic) parametre olarak verilir.
+#define MREQ_TOPIC_DECLARE_AS(NAME, ...) \
+    extern __VA_ARGS__ NAME##_topic_instance;
 
-#define MREQ_TOPIC_DEFINE(MSGTYPE, NAME, BUFFER_SIZE) \
-    mreq::Topic<MSGTYPE, BUFFER_SIZE> NAME##_topic_instance; \
+#define MREQ_TOPIC_DEFINE_AS(NAME, ...) \
+    __VA_ARGS__ NAME##_topic_instance; \
     namespace { \
         struct NAME##_topic_initializer { \
             NAME##_topic_initializer() { \
@@ -194,9 +262,24 @@ inline bool register_topic_metadata(const mreq_metadata* metadata) noexcept {
         [[maybe_unused]] static NAME##_topic_initializer NAME##_init_instance; \
     }
 
+#define MREQ_TOPIC_DECLARE(MSGTYPE, NAME, BUFFER_SIZE) \
+    MREQ_TOPIC_DECLARE_AS(NAME, mreq::Topic<MSGTYPE, BUFFER_SIZE>)
+
+#define MREQ_TOPIC_DEFINE(MSGTYPE, NAME, BUFFER_SIZE) \
+    MREQ_TOPIC_DEFINE_AS(NAME, mreq::Topic<MSGTYPE, BUFFER_SIZE>)
+
 // Updated macros compatible with your existing API
 #define REGISTER_TOPIC(MSGTYPE, NAME) \
     MREQ_TOPIC_DEFINE(MSGTYPE, NAME, 1)
 
 #define REGISTER_TOPIC_WITH_BUFFER(MSGTYPE, NAME, BUFFER_SIZE) \
-    MREQ_TOPIC_DEFINE(MSGTYPE, NAME, BUFFER_SIZE)
\ No newline at end of file
+    MREQ_TOPIC_DEFINE(MSGTYPE, NAME, BUFFER_SIZE)
+
+#define REGISTER_SEQLOCK_TOPIC(MSGTYPE, NAME, BUFFER_SIZE) \
+    MREQ_TOPIC_DEFINE_AS(NAME, mreq::SeqlockTopic<MSGTYPE, BUFFER_SIZE>)
+
+#define REGISTER_MULTI_PRODUCER_TOPIC(MSGTYPE, NAME, BUFFER_SIZE) \
+    MREQ_TOPIC_DEFINE_AS(NAME, mreq::MultiProducerTopic<MSGTYPE, BUFFER_SIZE>)
+
+#define REGISTER_LATEST_TOPIC(MSGTYPE, NAME) \
+    MREQ_TOPIC_DEFINE_AS(NAME, mreq::LatestTopic<MSGTYPE>)
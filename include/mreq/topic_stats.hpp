@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "subscriber_table.hpp"
+
+// Bir snapshot'ta raporlanabilecek en fazla abone; daha büyük kapasiteli topic'lerde
+// ilk MREQ_STATS_MAX_SUBSCRIBERS aktif abone raporlanır (topic sayaçları yine tamdır)
+#ifndef MREQ_STATS_MAX_SUBSCRIBERS
+#define MREQ_STATS_MAX_SUBSCRIBERS MREQ_MAX_SUBSCRIBERS
+#endif
+
+namespace mreq {
+
+// Abone başına sayaçlar
+struct SubscriberStats {
+    size_t token;
+    uint64_t read;      // Okunan mesaj sayısı
+    uint64_t lost;      // Ring üzerine yazıldığı için kaçırılan mesaj sayısı
+    uint64_t lag;       // Yayınlanmış ama henüz okunmamış mesaj sayısı (ring kapasitesini aşabilir)
+};
+
+// Bir topic'in anlık istatistik görüntüsü (TopicRegistry::get_stats / Topic::stats)
+// Sayaçlar sadece MREQ_ENABLE_STATS ile derlendiğinde tutulur; aksi halde enabled == false
+// ve sayaçlar sıfırdır (abone lag'i yine de doldurulur).
+struct TopicStatsSnapshot {
+    const char* topic_name;
+    bool enabled;
+    uint64_t published;         // Yayınlanan mesaj sayısı
+    uint64_t read;              // Tüm abonelerin okuduğu mesaj sayısı
+    uint64_t lost;              // Tüm abonelerin kaçırdığı mesaj sayısı
+    uint64_t lock_wait_ns;      // Topic kilidini beklemekle geçen toplam süre
+    uint64_t last_publish_ns;   // Son publish zamanı (mreq::now_ns), hiç yoksa 0
+    size_t subscriber_count;
+    SubscriberStats subscribers[MREQ_STATS_MAX_SUBSCRIBERS];
+};
+
+} // namespace mreq
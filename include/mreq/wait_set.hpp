@@ -0,0 +1,191 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include "mreq/clock.hpp"
+#include "mreq/event.hpp"
+#include "mreq/metadata.hpp"
+#include "mreq/internal/NonCopyable.hpp"
+#include "mreq/internal/TopicListeners.hpp"
+
+// Bir WaitSet'e eklenebilecek (topic, token) çifti sayısı
+#ifndef MREQ_WAITSET_MAX_ENTRIES
+#define MREQ_WAITSET_MAX_ENTRIES 64
+#endif
+
+using Token = size_t;
+
+namespace mreq {
+
+// Birden fazla (topic, token) çiftini tek çağrıyla bekleme.
+// Her publish, ilgili girişin bitini hazır bitmap'inde işaretler; poll() sadece işaretli
+// girişleri check() ile doğrular, böylece maliyet topic sayısına değil hazır topic sayısına bağlıdır.
+// wait() hazır giriş yoksa publish'e veya zaman aşımına kadar uyur (POSIX: condition variable).
+// poll()/wait()/add()/remove() tek bir sahip thread'den çağrılmalıdır; publish herhangi bir thread'den gelebilir.
+// Raporlanan ama tamamen okunmayan girişler sonraki poll()'da tekrar raporlanır.
+class WaitSet : private internal::NonCopyable {
+public:
+    static constexpr size_t kCapacity = MREQ_WAITSET_MAX_ENTRIES;
+private:
+    static constexpr size_t kWordBits = 32;
+    static constexpr size_t kWords = (kCapacity + kWordBits - 1) / kWordBits;
+
+    struct Entry {
+        void* topic = nullptr;
+        Token token = 0;
+        bool (*check_fn)(void*, Token) = nullptr;
+        bool (*attach_fn)(void*, const internal::TopicListener*) = nullptr;
+        void (*detach_fn)(void*, const internal::TopicListener*) = nullptr;
+        internal::TopicListener listener{};
+        bool used = false;
+    };
+
+    Entry entries_[kCapacity];
+    std::atomic<uint32_t> ready_[kWords] = {};   // publish tarafından işaretlenir
+    uint32_t reported_[kWords] = {};             // Son poll()'da raporlananlar (sahip thread)
+    std::atomic<bool> waiting_{false};
+    Event event_;
+
+    static uint32_t bit_of(size_t index) {
+        return 1u << (index % kWordBits);
+    }
+
+    // Publisher thread'inden çağrılır
+    static void on_publish(void* context, size_t index) {
+        WaitSet* self = static_cast<WaitSet*>(context);
+        const uint32_t mask = bit_of(index);
+        const uint32_t prev = self->ready_[index / kWordBits].fetch_or(mask);
+        if (!(prev & mask) && self->waiting_.load()) {
+            self->event_.notify();
+        }
+    }
+
+    bool entry_pending(const Entry& entry) const {
+        return entry.used && entry.check_fn(entry.topic, entry.token);
+    }
+
+    std::optional<size_t> add_entry(void* topic, Token token,
+                                    bool (*check_fn)(void*, Token),
+                                    bool (*attach_fn)(void*, const internal::TopicListener*),
+                                    void (*detach_fn)(void*, const internal::TopicListener*)) {
+        if (!topic || !check_fn || !attach_fn || !detach_fn) return std::nullopt;
+
+        for (size_t i = 0; i < kCapacity; ++i) {
+            Entry& entry = entries_[i];
+            if (entry.used) continue;
+
+            entry.topic = topic;
+            entry.token = token;
+            entry.check_fn = check_fn;
+            entry.attach_fn = attach_fn;
+            entry.detach_fn = detach_fn;
+            entry.listener = {&WaitSet::on_publish, this, i};
+            if (!attach_fn(topic, &entry.listener)) return std::nullopt;
+            entry.used = true;
+
+            // Eklemeden önce yayınlanmış ve henüz okunmamış mesajlar
+            if (check_fn(topic, token)) {
+                ready_[i / kWordBits].fetch_or(bit_of(i));
+            }
+            return i;
+        }
+        return std::nullopt;
+    }
+
+    // Önceki poll()'da raporlanıp hâlâ okunmamış mesajı olan girişleri tekrar işaretle
+    void rearm_reported() {
+        for (size_t w = 0; w < kWords; ++w) {
+            uint32_t bits = reported_[w];
+            reported_[w] = 0;
+            while (bits) {
+                const size_t index = w * kWordBits + static_cast<size_t>(__builtin_ctz(bits));
+                bits &= bits - 1;
+                if (entry_pending(entries_[index])) {
+                    ready_[w].fetch_or(bit_of(index), std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+public:
+    WaitSet() = default;
+
+    ~WaitSet() {
+        for (size_t i = 0; i < kCapacity; ++i) {
+            remove(i);
+        }
+    }
+
+    // Registry'deki type-erased bir topic'i ekler; giriş indeksini döndürür
+    std::optional<size_t> add(const mreq_metadata* metadata, Token token) {
+        if (!metadata) return std::nullopt;
+        return add_entry(metadata->topic_instance, token, metadata->check_fn,
+                         metadata->attach_listener_fn, metadata->detach_listener_fn);
+    }
+
+    // Topic, SeqlockTopic, MultiProducerTopic...
+    template<typename TopicT>
+    std::optional<size_t> add(TopicT& topic, Token token) {
+        return add_entry(&topic, token, &TopicT::static_check,
+                         &TopicT::static_attach_listener, &TopicT::static_detach_listener);
+    }
+
+    void remove(size_t index) {
+        if (index >= kCapacity || !entries_[index].used) return;
+        Entry& entry = entries_[index];
+        entry.detach_fn(entry.topic, &entry.listener);
+        entry.used = false;
+        ready_[index / kWordBits].fetch_and(~bit_of(index));
+        reported_[index / kWordBits] &= ~bit_of(index);
+    }
+
+    // Okunmamış mesajı olan girişlerin indekslerini out'a yazar (en fazla max), bloklamaz
+    size_t poll(size_t* out, size_t max) {
+        rearm_reported();
+
+        size_t count = 0;
+        for (size_t w = 0; w < kWords; ++w) {
+            uint32_t bits = ready_[w].exchange(0);
+            while (bits) {
+                if (count == max) {
+                    // Sığmayanlar sonraki çağrıya kalır
+                    ready_[w].fetch_or(bits, std::memory_order_relaxed);
+                    break;
+                }
+                const size_t index = w * kWordBits + static_cast<size_t>(__builtin_ctz(bits));
+                bits &= bits - 1;
+                if (entry_pending(entries_[index])) {
+                    out[count++] = index;
+                    reported_[w] |= bit_of(index);
+                }
+            }
+        }
+        return count;
+    }
+
+    // poll() gibi, ama hazır giriş yoksa publish'e veya timeout_ms dolana kadar bekler.
+    // Zaman aşımında 0 döner.
+    size_t wait(size_t* out, size_t max, uint32_t timeout_ms) {
+        size_t count = poll(out, max);
+        if (count > 0) return count;
+
+        waiting_.store(true);
+        // waiting_ işaretlendikten sonra tekrar bak: araya giren publish kaçmasın
+        count = poll(out, max);
+        // Önceki bir turdan kalan ya da okunmamış mesajı olmayan girişin sinyali boş bir
+        // uyanmaya yol açabilir: kalan süre kadar tekrar bekle
+        const uint64_t deadline = mreq::monotonic_ns() + uint64_t{timeout_ms} * 1000000u;
+        while (count == 0) {
+            const uint64_t now = mreq::monotonic_ns();
+            if (now >= deadline) break;
+            const uint32_t remaining_ms = static_cast<uint32_t>((deadline - now + 999999u) / 1000000u);
+            if (!event_.wait_for(remaining_ms)) break;
+            count = poll(out, max);
+        }
+        waiting_.store(false);
+        return count;
+    }
+};
+
+} // namespace mreq
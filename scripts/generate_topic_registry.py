@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 import os
+import random
 import re
 import sys
 from pathlib import Path
@@ -18,10 +19,186 @@ def extract_buffer_size(proto_content):
         return int(buffer_comment.group(1))
     return 1
 
+def extract_subscribers(proto_content):
+    """Extract per-topic subscriber capacity from proto file comments, default to MREQ_MAX_SUBSCRIBERS."""
+    subscribers_comment = re.search(r'//\s*@subscribers\s*:\s*(\d+)', proto_content)
+    if subscribers_comment:
+        return int(subscribers_comment.group(1))
+    return None
+
+def extract_raw_wire(proto_content, proto_filename):
+    """True if the message opts into the raw (memcpy) wire mode via `// @wire: raw`."""
+    wire_comment = re.search(r'//\s*@wire\s*:\s*(\w+)', proto_content)
+    if not wire_comment:
+        return False
+    wire = wire_comment.group(1).strip()
+    if wire not in ("raw", "nanopb"):
+        print(f"Error: Unknown @wire '{wire}' in {proto_filename} (expected raw or nanopb)")
+        sys.exit(1)
+    return wire == "raw"
+
+# @policy annotation -> topic class template
+TOPIC_POLICIES = {
+    "mutex": "mreq::Topic",
+    "seqlock": "mreq::SeqlockTopic",
+    "multi_producer": "mreq::MultiProducerTopic",
+    "latest": "mreq::LatestTopic",
+    "shm": "mreq::ShmTopic",
+}
+
+# Policies whose topic class lives outside mreq/topic.hpp
+POLICY_HEADERS = {
+    "seqlock": "mreq/seqlock_topic.hpp",
+    "multi_producer": "mreq/multi_producer_topic.hpp",
+    "latest": "mreq/latest_topic.hpp",
+    "shm": "mreq/platform/posix/shm_topic.hpp",
+}
+
+def extract_policy(proto_content, proto_filename):
+    """Extract topic policy from proto file comments, default to mutex."""
+    policy_comment = re.search(r'//\s*@policy\s*:\s*(\w+)', proto_content)
+    if not policy_comment:
+        return "mutex"
+    policy = policy_comment.group(1).strip()
+    if policy not in TOPIC_POLICIES:
+        print(f"Error: Unknown @policy '{policy}' in {proto_filename} "
+              f"(expected one of: {', '.join(TOPIC_POLICIES)})")
+        sys.exit(1)
+    return policy
+
+# @mutex annotation -> writer lock of a mutex-policy topic (POSIX only)
+TOPIC_MUTEXES = {
+    "pthread": "mreq::PthreadMutex",
+    "adaptive": "mreq::AdaptiveMutex",
+    "prio_inherit": "mreq::PriorityInheritMutex",
+}
+
+def extract_mutex(proto_content, proto_filename):
+    """Extract per-topic mutex from proto file comments, default to the global mreq::Mutex."""
+    mutex_comment = re.search(r'//\s*@mutex\s*:\s*(\w+)', proto_content)
+    if not mutex_comment:
+        return None
+    mutex = mutex_comment.group(1).strip()
+    if mutex not in TOPIC_MUTEXES:
+        print(f"Error: Unknown @mutex '{mutex}' in {proto_filename} "
+              f"(expected one of: {', '.join(TOPIC_MUTEXES)})")
+        sys.exit(1)
+    return mutex
+
+def topic_type(proto_info):
+    """Full C++ topic type for a proto entry."""
+    args = proto_info["message_type"]
+    # LatestTopic keeps only the newest value and has no ring size parameter
+    if proto_info["policy"] != "latest":
+        args += f', {proto_info["buffer_size"]}'
+    if proto_info["mutex"] is not None:
+        subscribers = proto_info["subscribers"]
+        args += f', {"MREQ_MAX_SUBSCRIBERS" if subscribers is None else subscribers}'
+        args += f', {TOPIC_MUTEXES[proto_info["mutex"]]}'
+    elif proto_info["subscribers"] is not None:
+        args += f', {proto_info["subscribers"]}'
+    return f'{TOPIC_POLICIES[proto_info["policy"]]}<{args}>'
+
+def uses_default_topic(proto_info):
+    """True if the entry can use the plain MREQ_TOPIC_* / REGISTER_TOPIC_* macros."""
+    return (proto_info["policy"] == "mutex" and proto_info["subscribers"] is None
+            and proto_info["mutex"] is None)
+
 def sanitize_for_identifier(name):
     """Replace any character that is not a letter, number, or underscore with an underscore."""
     return re.sub(r'[^a-zA-Z0-9_]', '_', name)
 
+def constexpr_hash(name, bits):
+    """djb2 hash, identical to mreq::constexpr_hash for a size_t of the given width."""
+    mask = (1 << bits) - 1
+    h = 5381
+    for byte in name.encode('utf-8'):
+        if byte >= 0x80:
+            byte -= 0x100  # char işaretli: C++ tarafında işaret genişletmesi yapılır
+        h = ((h << 5) + h + byte) & mask
+    return h
+
+def check_hash_collisions(topic_names):
+    """Fail the build if two topic names produce the same 32 or 64 bit message ID."""
+    for bits in (32, 64):
+        seen = {}
+        for name in topic_names:
+            h = constexpr_hash(name, bits)
+            if h in seen:
+                print(f"Error: constexpr_hash collision ({bits}-bit) between topics "
+                      f"'{seen[h]}' and '{name}' (0x{h:x})")
+                sys.exit(1)
+            seen[h] = name
+
+def perfect_hash_slot(message_id, seed, shift):
+    """Python mirror of mreq::perfect_hash_slot (include/mreq/perfect_hash.hpp)."""
+    return ((message_id & 0xFFFFFFFF) * seed & 0xFFFFFFFF) >> shift
+
+def find_perfect_hash(topic_names):
+    """Find (seed, shift) mapping every topic ID to a distinct slot of a power-of-two table."""
+    ids = [constexpr_hash(name, 32) for name in topic_names]
+    if len(ids) <= 1:
+        return 1, 32
+    bits = (len(ids) - 1).bit_length()
+    rng = random.Random(0)  # Deterministik çıktı
+    for table_bits in range(bits, bits + 4):
+        shift = 32 - table_bits
+        for _ in range(200000):
+            seed = rng.getrandbits(32) | 1
+            if len({perfect_hash_slot(i, seed, shift) for i in ids}) == len(ids):
+                return seed, shift
+    print("Error: Could not find a perfect hash for the topic IDs")
+    sys.exit(1)
+
+def write_lookup_table(f, topic_names):
+    """Emit the constexpr perfect-hash lookup for the generated topics."""
+    seed, shift = find_perfect_hash(topic_names)
+    table_size = 1 << (32 - shift)
+    count = len(topic_names)
+
+    index_table = [count] * table_size
+    for idx, name in enumerate(topic_names):
+        index_table[perfect_hash_slot(constexpr_hash(name, 32), seed, shift)] = idx
+
+    f.write(f"""// Derleme zamanı perfect hash: message_id -> topic indeksi (O(1), dalsız)
+constexpr size_t topic_count = {count};
+constexpr uint32_t topic_hash_seed = 0x{seed:08x}u;
+constexpr unsigned topic_hash_shift = {shift};
+
+// Son eleman boş slotlar için gözcü (sentinel)
+constexpr size_t topic_ids[topic_count + 1] = {{
+""")
+    for name in topic_names:
+        f.write(f'    mreq::constexpr_hash("{name}"),\n')
+    f.write("""    0
+};
+static_assert(mreq::message_ids_unique(topic_ids, topic_count),
+              "constexpr_hash collision between generated topics");
+
+""")
+    f.write(f"constexpr uint16_t topic_index_table[{table_size}] = {{")
+    f.write(", ".join(str(i) for i in index_table))
+    f.write("""};
+
+constexpr size_t topic_index(size_t message_id) {
+    return topic_index_table[mreq::perfect_hash_slot(message_id, topic_hash_seed, topic_hash_shift)];
+}
+
+""")
+    for idx, name in enumerate(topic_names):
+        f.write(f'static_assert(topic_index(topic_ids[{idx}]) == {idx}, "perfect hash mismatch for {name}");\n')
+    f.write("""
+// İndeks -> metadata (son eleman nullptr)
+extern const mreq_metadata* const topic_metadata_table[topic_count + 1];
+
+// O(1) topic lookup; bilinmeyen ID için nullptr
+inline const mreq_metadata* find_topic_by_id(size_t message_id) noexcept {
+    const size_t idx = topic_index(message_id);
+    return topic_ids[idx] == message_id ? topic_metadata_table[idx] : nullptr;
+}
+
+""")
+
 def generate_registry_code(proto_files, output_dir):
     """Generate topic registry code from proto files."""
     os.makedirs(output_dir, exist_ok=True)
@@ -38,24 +215,64 @@ def generate_registry_code(proto_files, output_dir):
                 message_type = message_match.group(1)
                 topic_names = extract_topic_names(content, proto_file)
                 buffer_size = extract_buffer_size(content)
+                policy = extract_policy(content, proto_file)
+                subscribers = extract_subscribers(content)
+                raw_wire = extract_raw_wire(content, proto_file)
+                mutex = extract_mutex(content, proto_file)
+                if mutex is not None and policy != "mutex":
+                    print(f"Error: @mutex is only supported with @policy: mutex in {proto_file}")
+                    sys.exit(1)
+                if policy == "latest" and buffer_size != 1:
+                    print(f"Error: @buffer is not supported with @policy: latest in {proto_file}")
+                    sys.exit(1)
+                if subscribers == 0:
+                    print(f"Error: @subscribers must be at least 1 in {proto_file}")
+                    sys.exit(1)
                 proto_info_list.append({
                     "file_path": proto_file,
                     "message_type": message_type,
                     "topic_names": topic_names,
-                    "buffer_size": buffer_size
+                    "buffer_size": buffer_size,
+                    "policy": policy,
+                    "subscribers": subscribers,
+                    "raw_wire": raw_wire,
+                    "mutex": mutex
                 })
 
+    topic_names = [sanitize_for_identifier(name)
+                   for proto_info in proto_info_list
+                   for name in proto_info["topic_names"]]
+    if len(set(topic_names)) != len(topic_names):
+        print("Error: Duplicate topic names in proto files")
+        sys.exit(1)
+    check_hash_collisions(topic_names)
+
     # Generate header file
     with open(hpp_path, 'w') as f:
         f.write("""#pragma once
 
+#include <cstdint>
 #include "mreq/metadata.hpp"
+#include "mreq/perfect_hash.hpp"
 #include "mreq/topic.hpp"
 #include "mreq/topic_registry.hpp"
 """)
+        policy_headers = sorted({POLICY_HEADERS[p["policy"]] for p in proto_info_list
+                                 if p["policy"] in POLICY_HEADERS})
+        for header in policy_headers:
+            f.write(f'#include "{header}"\n')
         for proto_info in proto_info_list:
             proto_name = Path(proto_info["file_path"]).stem
             f.write(f'#include <{proto_name}.pb.h>\n')
+        # nanopb only emits <Msg>_size for messages with bounded fields
+        f.write("\n")
+        for message_type in sorted({p["message_type"] for p in proto_info_list}):
+            f.write(f'#ifdef {message_type}_size\n'
+                    f'MREQ_MAX_ENCODED_SIZE({message_type})\n'
+                    f'#endif\n')
+        raw_types = sorted({p["message_type"] for p in proto_info_list if p["raw_wire"]})
+        for message_type in raw_types:
+            f.write(f'MREQ_RAW_LAYOUT({message_type})\n')
         f.write("""
 namespace mreq {
 namespace autogen {
@@ -68,7 +285,12 @@ namespace autogen {
                 message_type = proto_info["message_type"]
                 f.write(f'// Topic: {topic_name}\n')
                 f.write(f'MREQ_METADATA_DECLARE({sanitized_name});\n')
-                f.write(f'MREQ_TOPIC_DECLARE({message_type}, {sanitized_name}, {buffer_size});\n\n')
+                if uses_default_topic(proto_info):
+                    f.write(f'MREQ_TOPIC_DECLARE({message_type}, {sanitized_name}, {buffer_size});\n\n')
+                else:
+                    f.write(f'MREQ_TOPIC_DECLARE_AS({sanitized_name}, {topic_type(proto_info)});\n\n')
+
+        write_lookup_table(f, topic_names)
 
         f.write("""} // namespace autogen
 } // namespace mreq
@@ -89,8 +311,17 @@ namespace autogen {
                 message_type = proto_info["message_type"]
                 
                 f.write(f'// Topic: {topic_name}\n')
-                f.write(f'REGISTER_TOPIC_WITH_BUFFER({message_type}, {sanitized_name}, {buffer_size});\n')
-                f.write(f'MREQ_NANOPB_METADATA_DEFINE({message_type}, {sanitized_name}, {buffer_size});\n\n')
+                if uses_default_topic(proto_info):
+                    f.write(f'REGISTER_TOPIC_WITH_BUFFER({message_type}, {sanitized_name}, {buffer_size});\n')
+                    f.write(f'MREQ_NANOPB_METADATA_DEFINE({message_type}, {sanitized_name}, {buffer_size});\n\n')
+                else:
+                    f.write(f'MREQ_TOPIC_DEFINE_AS({sanitized_name}, {topic_type(proto_info)});\n')
+                    f.write(f'MREQ_NANOPB_METADATA_DEFINE_AS({message_type}, {sanitized_name}, {topic_type(proto_info)});\n\n')
+
+        f.write("const mreq_metadata* const topic_metadata_table[topic_count + 1] = {\n")
+        for name in topic_names:
+            f.write(f'    MREQ_GET_METADATA({name}),\n')
+        f.write("    nullptr\n};\n\n")
 
         f.write("""} // namespace autogen
 } // namespace mreq
@@ -0,0 +1,28 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+
+// MREQ_PLATFORM_BAREMETAL ile, MREQ_BAREMETAL_NOW_NS olmadan derlenir: now_ns() hep 0 döner
+
+namespace {
+
+struct Sample {
+    int32_t value;
+    uint64_t timestamp;
+};
+
+} // namespace
+
+TEST(BaremetalClockTest, ThrottledSubscriptionRejectedWithoutClock) {
+    static_assert(!mreq::kHasClock, "test saat kaynağı olmadan derlenmeli");
+    mreq::Topic<Sample, 4> topic;
+
+    EXPECT_FALSE(topic.subscribe(mreq::SubscribeOptions::at_most_every(1'000'000)).has_value());
+
+    // Zamana dayanmayan seçenekler saat olmadan da çalışır
+    auto every = topic.subscribe(mreq::SubscribeOptions::every(2));
+    ASSERT_TRUE(every.has_value());
+    for (int i = 1; i <= 4; ++i) topic.publish({i, 0});
+    auto msg = topic.read(*every);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value, 2);
+}
@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "mreq/platform/posix/bridge.hpp"
+#include "test_messages.hpp"
+#include <string>
+
+namespace {
+
+// sender test_log_topic'i iletir; receiver gelenleri test_log_mp_topic'e yayınlar
+void exchange(mreq::SocketBridge& sender, mreq::SocketBridge& receiver) {
+    const mreq::mreq_metadata* source = MREQ_GET_METADATA(test_log_topic);
+    const mreq::mreq_metadata* sink = MREQ_GET_METADATA(test_log_mp_topic);
+    ASSERT_TRUE(sender.add(source));
+    ASSERT_TRUE(receiver.route(source->message_id, sink));
+    auto token = sink->subscribe().value();
+
+    TestLogMessage out[16];
+    int next = 0;
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 12; ++i) {
+            test_log_topic_topic_instance.publish({round * 12 + i, 7, 2.0f});
+        }
+        EXPECT_EQ(sender.send(), 12u);
+
+        size_t received = 0;
+        for (int spin = 0; spin < 1000 && received < 12; ++spin) {
+            received += receiver.receive();
+        }
+        ASSERT_EQ(received, 12u);
+        ASSERT_EQ(sink->read_multiple(token, out, 16), 12u);
+        for (int i = 0; i < 12; ++i) {
+            EXPECT_EQ(out[i].value, next++);
+            EXPECT_EQ(out[i].timestamp, 7u);
+        }
+    }
+    // Birden fazla çerçeve tek datagramda gider
+    EXPECT_LT(sender.datagrams_sent(), sender.frames_sent());
+    EXPECT_EQ(sender.errors(), 0u);
+    EXPECT_EQ(sender.lost(), 0u);
+    EXPECT_EQ(receiver.errors(), 0u);
+    sink->unsubscribe(token);
+}
+
+} // namespace
+
+TEST(BridgeTest, UdpLoopback) {
+    mreq::SocketBridge receiver;
+    ASSERT_TRUE(receiver.open_udp("127.0.0.1", 0));
+    mreq::SocketBridge sender;
+    ASSERT_TRUE(sender.open_udp("127.0.0.1", 0, "127.0.0.1", receiver.local_port()));
+    exchange(sender, receiver);
+}
+
+TEST(BridgeTest, UnixDatagram) {
+    const std::string base = ::testing::TempDir() + "mreq_br_" + std::to_string(getpid());
+    const std::string rx_path = base + "_rx";
+    const std::string tx_path = base + "_tx";
+    mreq::SocketBridge receiver;
+    ASSERT_TRUE(receiver.open_unix(rx_path.c_str()));
+    mreq::SocketBridge sender;
+    ASSERT_TRUE(sender.open_unix(tx_path.c_str(), rx_path.c_str()));
+    exchange(sender, receiver);
+}
+
+TEST(BridgeTest, ForwardedTopicsAreNotEchoed) {
+    mreq::SocketBridge a;
+    mreq::SocketBridge b;
+    ASSERT_TRUE(a.open_udp("127.0.0.1", 0));
+    ASSERT_TRUE(b.open_udp("127.0.0.1", 0, "127.0.0.1", a.local_port()));
+    ASSERT_TRUE(a.add(MREQ_GET_METADATA(test_log_topic)));
+    ASSERT_TRUE(b.add(MREQ_GET_METADATA(test_log_topic)));
+
+    // b'nin gönderdiği test_log_topic çerçevesi, aynı topic'i ileten a'da yayınlanmaz
+    test_log_topic_topic_instance.publish({1, 0, 0.0f});
+    ASSERT_EQ(b.send(), 1u);
+    for (int spin = 0; spin < 1000 && a.dropped() == 0; ++spin) {
+        a.receive();
+    }
+    EXPECT_EQ(a.dropped(), 1u);
+    EXPECT_EQ(a.frames_received(), 0u);
+}
+
+TEST(BridgeTest, CountsRingOverrunAndUnsentFrames) {
+    const std::string base = ::testing::TempDir() + "mreq_br_lost_" + std::to_string(getpid());
+    const std::string tx_path = base + "_tx";
+    const std::string missing_path = base + "_missing";
+    mreq::SocketBridge sender;
+    ASSERT_TRUE(sender.open_unix(tx_path.c_str(), missing_path.c_str()));
+    ASSERT_TRUE(sender.add(MREQ_GET_METADATA(test_log_topic)));
+
+    // 20 mesajın 4'ü köprü okuyamadan ring'den (16) düşer; karşı uç olmadığı için
+    // okunan 16 mesajın datagramı da gönderilemez
+    for (int i = 0; i < 20; ++i) {
+        test_log_topic_topic_instance.publish({i, 0, 0.0f});
+    }
+    EXPECT_EQ(sender.send(), 0u);
+    EXPECT_EQ(sender.frames_sent(), 0u);
+    EXPECT_EQ(sender.datagrams_sent(), 0u);
+    EXPECT_EQ(sender.lost(), 20u);
+    EXPECT_GT(sender.errors(), 0u);
+}
@@ -0,0 +1,200 @@
+#ifdef MREQ_ENABLE_COROUTINES
+
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "mreq/coroutine.hpp"
+#include "test_messages.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using SmallTopic = mreq::Topic<TestMessage1, 4>;
+using WideTopic = mreq::Topic<TestMessage1, 4, 256>;
+
+mreq::Task collect(SmallTopic* topic, Token token, std::vector<int>* out, size_t count) {
+    while (out->size() < count) {
+        auto msg = co_await topic->next(token);
+        if (!msg) co_return;
+        out->push_back(msg->value1);
+    }
+}
+
+mreq::Task wait_one(WideTopic* topic, int* received) {
+    Token token = topic->subscribe().value();
+    auto msg = co_await topic->next(token);
+    if (msg && msg->value1 == 42) ++*received;
+    topic->unsubscribe(token);
+}
+
+mreq::Task zip(SmallTopic* a, Token ta, SmallTopic* b, Token tb, int* sum) {
+    auto first = co_await a->next(ta);
+    auto second = co_await b->next(tb);
+    *sum = first->value1 + second->value1;
+}
+
+mreq::Task until_value(SmallTopic* topic, Token token, int last, std::atomic<int>* seen) {
+    for (;;) {
+        auto msg = co_await topic->next(token);
+        if (!msg) co_return;
+        seen->fetch_add(1);
+        if (msg->value1 == last) co_return;
+    }
+}
+
+struct DestroyCounter {
+    int* count;
+    ~DestroyCounter() { ++*count; }
+};
+
+mreq::Task wait_forever(SmallTopic* topic, Token token, int* destroyed) {
+    DestroyCounter guard{destroyed};
+    co_await topic->next(token);
+    ADD_FAILURE() << "mesaj yayınlanmadan devam edildi";
+}
+
+} // namespace
+
+TEST(CoroutineTest, ResumesOnPublish) {
+    SmallTopic topic;
+    Token token = topic.subscribe().value();
+    std::vector<int> received;
+
+    mreq::Executor executor;
+    executor.spawn(collect(&topic, token, &received, 3));
+    EXPECT_EQ(executor.poll(), 1u);
+    EXPECT_EQ(executor.task_count(), 1u);
+    EXPECT_TRUE(received.empty());
+
+    EXPECT_EQ(executor.poll(), 0u);
+    topic.publish({1, 0.0f, 1});
+    EXPECT_EQ(executor.poll(), 1u);
+    ASSERT_EQ(received.size(), 1u);
+
+    // Tek devam ettirmede birikmiş tüm mesajlar askıya alınmadan okunur
+    topic.publish({2, 0.0f, 2});
+    topic.publish({3, 0.0f, 3});
+    EXPECT_EQ(executor.poll(), 1u);
+    EXPECT_EQ(received, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(executor.task_count(), 0u);
+}
+
+TEST(CoroutineTest, MessageBeforeAwaitDoesNotSuspend) {
+    SmallTopic topic;
+    Token token = topic.subscribe().value();
+    topic.publish({7, 0.0f, 7});
+    std::vector<int> received;
+
+    mreq::Executor executor;
+    executor.spawn(collect(&topic, token, &received, 1));
+    executor.poll();
+    EXPECT_EQ(received, (std::vector<int>{7}));
+    EXPECT_EQ(executor.task_count(), 0u);
+}
+
+TEST(CoroutineTest, ManyConsumersShareOneThread) {
+    constexpr int kConsumers = 200;
+    WideTopic topic;
+    int received = 0;
+
+    mreq::Executor executor;
+    for (int i = 0; i < kConsumers; ++i) {
+        executor.spawn(wait_one(&topic, &received));
+    }
+    executor.poll();
+    EXPECT_EQ(executor.task_count(), static_cast<size_t>(kConsumers));
+
+    topic.publish({42, 0.0f, 1});
+    EXPECT_EQ(executor.poll(), static_cast<size_t>(kConsumers));
+    EXPECT_EQ(received, kConsumers);
+    EXPECT_EQ(executor.task_count(), 0u);
+}
+
+TEST(CoroutineTest, AwaitsSeveralTopics) {
+    SmallTopic a;
+    SmallTopic b;
+    Token ta = a.subscribe().value();
+    Token tb = b.subscribe().value();
+    int sum = 0;
+
+    mreq::Executor executor;
+    executor.spawn(zip(&a, ta, &b, tb, &sum));
+    executor.poll();
+
+    b.publish({20, 0.0f, 0});
+    executor.poll();
+    EXPECT_EQ(executor.task_count(), 1u);    // Hâlâ a'yı bekliyor
+
+    a.publish({1, 0.0f, 0});
+    executor.poll();
+    EXPECT_EQ(sum, 21);
+    EXPECT_EQ(executor.task_count(), 0u);
+}
+
+TEST(CoroutineTest, RunWakesOnCrossThreadPublish) {
+    constexpr int kMessages = 100;
+    SmallTopic topic;
+    Token token = topic.subscribe().value();
+    std::atomic<int> seen{0};
+
+    mreq::Executor executor;
+    executor.spawn(until_value(&topic, token, kMessages, &seen));
+    std::thread runner([&executor] { executor.run(); });
+
+    for (int i = 1; i <= kMessages; ++i) {
+        topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    runner.join();    // Task son mesajı görünce biter, run() döner
+    EXPECT_GT(seen.load(), 0);
+    EXPECT_EQ(executor.task_count(), 0u);
+}
+
+TEST(CoroutineTest, UnsubscribedTokenYieldsNullopt) {
+    SmallTopic topic;
+    Token token = topic.subscribe().value();
+    topic.unsubscribe(token);
+    std::vector<int> received;
+
+    mreq::Executor executor;
+    executor.spawn(collect(&topic, token, &received, 1));
+    executor.run();    // Task askıda kalmaz, run() döner
+    EXPECT_TRUE(received.empty());
+    EXPECT_EQ(executor.task_count(), 0u);
+}
+
+TEST(CoroutineTest, StopEndsRun) {
+    SmallTopic topic;
+    Token token = topic.subscribe().value();
+    int destroyed = 0;
+    {
+        mreq::Executor executor;
+        executor.spawn(wait_forever(&topic, token, &destroyed));
+        executor.poll();   // Task başlar ve topic'te askıya alınır
+        // stop() run() thread'de başlamadan da gelebilir; her iki sırada da run() döner
+        std::thread runner([&executor] { executor.run(); });
+        executor.stop();
+        runner.join();
+        EXPECT_EQ(executor.task_count(), 1u);
+        EXPECT_EQ(destroyed, 0);
+    }
+    // Executor bitmemiş Task frame'lerini yok eder ve topic'ten ayrılır
+    EXPECT_EQ(destroyed, 1);
+    topic.publish({1, 0.0f, 1});
+}
+
+TEST(CoroutineTest, StopBeforeRunIsNotLost) {
+    SmallTopic topic;
+    Token token = topic.subscribe().value();
+    int destroyed = 0;
+    mreq::Executor executor;
+    executor.spawn(wait_forever(&topic, token, &destroyed));
+    executor.stop();
+    executor.run();   // Bekleyen stop tüketilir, bloklamadan döner
+    EXPECT_EQ(executor.task_count(), 1u);
+    EXPECT_EQ(destroyed, 0);
+}
+
+#endif // MREQ_ENABLE_COROUTINES
@@ -64,4 +64,33 @@ TEST(IntegrationTest, RingBufferOverrun) {
     }
     EXPECT_EQ(count, 5);
     EXPECT_EQ(first_val, 2.0);
-}
\ No newline at end of file
+}
+// Makrolar topic'i tanımlandığı sınıf üzerinden okur (mutex tabanlı Topic'e çevirmez)
+TEST(IntegrationTest, ReadMacrosUseDeclaredTopicType) {
+    auto mp_token = MREQ_SUBSCRIBE(test_mp_topic);
+    auto latest_token = MREQ_SUBSCRIBE(test_latest_topic);
+    ASSERT_TRUE(mp_token.has_value());
+    ASSERT_TRUE(latest_token.has_value());
+
+    TestMessage1 msgs[3] = {{1, 0.0f, 1}, {2, 0.0f, 2}, {3, 0.0f, 3}};
+    for (const TestMessage1& msg : msgs) {
+        MREQ_PUBLISH(test_mp_topic, msg);
+        MREQ_PUBLISH(test_latest_topic, msg);
+    }
+
+    auto first = MREQ_READ(test_mp_topic, *mp_token);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->value1, 1);
+    TestMessage1 rest[4];
+    EXPECT_EQ(MREQ_READ_MULTIPLE(test_mp_topic, *mp_token, rest, 4), 2u);
+    EXPECT_EQ(rest[1].value1, 3);
+
+    // LatestTopic sadece en güncel durumu verir
+    auto latest = MREQ_READ(test_latest_topic, *latest_token);
+    ASSERT_TRUE(latest.has_value());
+    EXPECT_EQ(latest->value1, 3);
+    EXPECT_FALSE(MREQ_READ(test_latest_topic, *latest_token).has_value());
+
+    MREQ_UNSUBSCRIBE(test_mp_topic, *mp_token);
+    MREQ_UNSUBSCRIBE(test_latest_topic, *latest_token);
+}
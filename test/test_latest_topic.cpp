@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "test_messages.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(LatestTopicTest, ReadReturnsNewestValue) {
+    mreq::LatestTopic<TestMessage1> topic;
+    auto token = topic.subscribe().value();
+    EXPECT_FALSE(topic.check(token));
+    EXPECT_FALSE(topic.read(token).has_value());
+
+    for (int i = 1; i <= 5; ++i) {
+        topic.publish({i, 0.5f, static_cast<uint64_t>(i)});
+    }
+
+    ASSERT_TRUE(topic.check(token));
+    mreq::ReadInfo info;
+    auto msg = topic.read(token, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 5);
+    EXPECT_EQ(info.sequence, 5u);
+    EXPECT_EQ(info.dropped, 4u);
+
+    EXPECT_FALSE(topic.check(token));
+    EXPECT_FALSE(topic.read(token).has_value());
+
+    topic.publish({6, 0.0f, 6});
+    TestMessage1 out[4];
+    ASSERT_EQ(topic.read_multiple(token, out, 4, info), 1u);
+    EXPECT_EQ(out[0].value1, 6);
+    EXPECT_EQ(info.dropped, 0u);
+    topic.unsubscribe(token);
+}
+
+TEST(LatestTopicTest, SubscribeSkipsOldMessages) {
+    mreq::LatestTopic<TestMessage1> topic;
+    topic.publish({1, 0.0f, 1});
+
+    auto token = topic.subscribe().value();
+    EXPECT_FALSE(topic.check(token));
+
+    topic.publish({2, 0.0f, 2});
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 2);
+}
+
+TEST(LatestTopicTest, LoanAndPublishMultiple) {
+    mreq::LatestTopic<TestMessage1, 2> topic;
+    auto token = topic.subscribe().value();
+
+    auto slot = topic.loan();
+    slot->value1 = 5;
+    slot->value2 = 0.0f;
+    slot->timestamp = 6;
+    EXPECT_FALSE(topic.check(token));
+    slot.commit();
+
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 5);
+
+    // Sadece son mesaj saklanır, sequence toplam kadar ilerler
+    TestMessage1 batch[3] = {{7, 0.0f, 7}, {8, 0.0f, 8}, {9, 0.0f, 9}};
+    topic.publish_multiple(batch, 3);
+    mreq::ReadInfo info;
+    msg = topic.read(token, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 9);
+    EXPECT_EQ(info.sequence, 4u);
+    EXPECT_EQ(info.dropped, 2u);
+}
+
+TEST(LatestTopicTest, MetadataPath) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_latest_topic);
+    auto token = meta->subscribe().value();
+
+    TestMessage1 msg{11, 1.5f, 12};
+    meta->publish(&msg);
+    meta->publish(&msg);
+    ASSERT_TRUE(meta->check(token));
+
+    mreq::ReadInfo info;
+    auto out = meta->read<TestMessage1>(token, info);
+    ASSERT_TRUE(out.has_value());
+    EXPECT_EQ(out->value1, 11);
+    EXPECT_EQ(info.dropped, 1u);
+    meta->unsubscribe(token);
+}
+
+TEST(LatestTopicTest, ConcurrentReadersNeverSeeTornMessages) {
+    // 3 okuyucu, 4 abone kapasitesi: 6 tampon
+    static mreq::LatestTopic<TestMessage3, 4> topic;
+    constexpr uint64_t kMessages = 50000;
+
+    std::atomic<bool> torn{false};
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> reads{0};
+    std::vector<std::thread> readers;
+
+    for (int r = 0; r < 3; ++r) {
+        auto token = topic.subscribe().value();
+        readers.emplace_back([token, &torn, &done, &reads] {
+            uint64_t last = 0;
+            auto drain = [&] {
+                mreq::ReadInfo info;
+                while (auto msg = topic.read(token, info)) {
+                    for (uint8_t byte : msg->data) {
+                        if (byte != static_cast<uint8_t>(msg->timestamp)) torn = true;
+                    }
+                    // Her okuma daha yeni bir mesaj vermeli ve sequence ile tutarlı olmalı
+                    if (msg->timestamp <= last || msg->timestamp != info.sequence) torn = true;
+                    last = msg->timestamp;
+                    reads.fetch_add(1, std::memory_order_relaxed);
+                }
+            };
+            while (!done.load()) drain();
+            drain();
+            if (last != kMessages) torn = true;   // Son değer her zaman görülmeli
+        });
+    }
+
+    for (uint64_t i = 1; i <= kMessages; ++i) {
+        TestMessage3 msg{};
+        std::fill(std::begin(msg.data), std::end(msg.data), static_cast<uint8_t>(i));
+        msg.timestamp = i;
+        topic.publish(msg);
+    }
+    done = true;
+
+    for (auto& t : readers) t.join();
+    EXPECT_FALSE(torn.load());
+    EXPECT_GT(reads.load(), 0u);
+}
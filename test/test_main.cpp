@@ -11,4 +11,23 @@ MREQ_METADATA_DEFINE(TestMessage2, test_topic_2, 5);
 REGISTER_TOPIC_WITH_BUFFER(TestMessage3, test_topic_3, 1);
 MREQ_METADATA_DEFINE(TestMessage3, test_topic_3, 1);
 
+REGISTER_MULTI_PRODUCER_TOPIC(TestMessage1, test_mp_topic, 8);
+MREQ_NANOPB_METADATA_DEFINE_AS(TestMessage1, test_mp_topic, mreq::MultiProducerTopic<TestMessage1, 8>);
+
+REGISTER_LATEST_TOPIC(TestMessage1, test_latest_topic);
+MREQ_NANOPB_METADATA_DEFINE_AS(TestMessage1, test_latest_topic, mreq::LatestTopic<TestMessage1>);
+
+PB_BIND(TestLogMessage, TestLogMessage, AUTO)
+
+REGISTER_TOPIC_WITH_BUFFER(TestLogMessage, test_log_topic, 16);
+MREQ_NANOPB_METADATA_DEFINE(TestLogMessage, test_log_topic, 16);
+
+REGISTER_MULTI_PRODUCER_TOPIC(TestLogMessage, test_log_mp_topic, 16);
+MREQ_NANOPB_METADATA_DEFINE_AS(TestLogMessage, test_log_mp_topic, mreq::MultiProducerTopic<TestLogMessage, 16>);
+
+PB_BIND(TestNameMessage, TestNameMessage, AUTO)
+
+REGISTER_TOPIC_WITH_BUFFER(TestNameMessage, test_name_topic, 8);
+MREQ_NANOPB_METADATA_DEFINE(TestNameMessage, test_name_topic, 8);
+
 // GoogleTest ana fonksiyonu
\ No newline at end of file
@@ -21,6 +21,41 @@ struct TestMessage3 {
     uint64_t timestamp;
 };
 
+// nanopb tanımlayıcısı olmayan test mesajı için (encode/decode kullanılmaz)
+constexpr const pb_msgdesc_t* TestMessage1_fields = nullptr;
+
+// nanopb ile kodlanabilen test mesajı (.pb.h çıktısının elle yazılmış eşdeğeri, PB_BIND test_main.cpp'de)
+struct TestLogMessage {
+    int32_t value;
+    uint64_t timestamp;
+    float reading;
+};
+
+#define TestLogMessage_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, INT32,    value,             1) \
+X(a, STATIC,   SINGULAR, UINT64,   timestamp,         2) \
+X(a, STATIC,   SINGULAR, FLOAT,    reading,           3)
+#define TestLogMessage_CALLBACK NULL
+#define TestLogMessage_DEFAULT NULL
+
+extern const pb_msgdesc_t TestLogMessage_msg;
+#define TestLogMessage_fields &TestLogMessage_msg
+#define TestLogMessage_size 27
+MREQ_RAW_LAYOUT(TestLogMessage)
+MREQ_MAX_ENCODED_SIZE(TestLogMessage)
+
+// Kodlanması başarısız olabilen mesaj: name sonlandırılmazsa nanopb encode hata verir
+struct TestNameMessage {
+    char name[8];
+};
+
+#define TestNameMessage_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, STRING,   name,              1)
+#define TestNameMessage_CALLBACK NULL
+#define TestNameMessage_DEFAULT NULL
+
+extern const pb_msgdesc_t TestNameMessage_msg;
+#define TestNameMessage_fields &TestNameMessage_msg
 
 // Yeni API'ye göre metadata ve topic bildirimleri
 MREQ_METADATA_DECLARE(test_topic_1);
@@ -30,4 +65,19 @@ MREQ_METADATA_DECLARE(test_topic_2);
 MREQ_TOPIC_DECLARE(TestMessage2, test_topic_2, 5);
 
 MREQ_METADATA_DECLARE(test_topic_3);
-MREQ_TOPIC_DECLARE(TestMessage3, test_topic_3, 1);
\ No newline at end of file
+MREQ_TOPIC_DECLARE(TestMessage3, test_topic_3, 1);
+
+MREQ_METADATA_DECLARE(test_mp_topic);
+MREQ_TOPIC_DECLARE_AS(test_mp_topic, mreq::MultiProducerTopic<TestMessage1, 8>);
+
+MREQ_METADATA_DECLARE(test_latest_topic);
+MREQ_TOPIC_DECLARE_AS(test_latest_topic, mreq::LatestTopic<TestMessage1>);
+
+MREQ_METADATA_DECLARE(test_log_topic);
+MREQ_TOPIC_DECLARE(TestLogMessage, test_log_topic, 16);
+
+MREQ_METADATA_DECLARE(test_log_mp_topic);
+MREQ_TOPIC_DECLARE_AS(test_log_mp_topic, mreq::MultiProducerTopic<TestLogMessage, 16>);
+
+MREQ_METADATA_DECLARE(test_name_topic);
+MREQ_TOPIC_DECLARE(TestNameMessage, test_name_topic, 8);
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "mreq/mreq.hpp"
+#include "mreq/log_format.hpp"
 #include "test_messages.hpp"
 
 TEST(MetadataTest, Macros) {
@@ -24,3 +25,32 @@ TEST(MetadataTest, Comparison) {
   EXPECT_EQ(metadata1, metadata1_again);
   EXPECT_NE(metadata1, metadata2);
 }
+
+TEST(MetadataTest, MaxEncodedSize) {
+  static_assert(mreq::max_encoded_size<TestLogMessage>() == TestLogMessage_size, "");
+  static_assert(mreq::max_encoded_size<TestMessage1>() == 0, "_size'ı olmayan tip sınırsız sayılmalı");
+  static_assert(mreq::log::max_frame_size<TestLogMessage>() == mreq::log::frame_size(TestLogMessage_size), "");
+
+  auto *metadata = MREQ_GET_METADATA(test_log_topic);
+  EXPECT_EQ(metadata->max_encoded_size, TestLogMessage_size);
+  EXPECT_EQ(mreq::log::max_frame_size(*metadata), mreq::log::max_frame_size<TestLogMessage>());
+  EXPECT_EQ(MREQ_GET_METADATA(test_topic_1)->max_encoded_size, 0u);
+
+  // En kötü durum: negatif int32 ve en büyük uint64 varint'leri 10 bayt
+  const TestLogMessage worst{-1, UINT64_MAX, 1.0f};
+  const TestLogMessage small{1, 2, 0.0f};
+  uint8_t buffer[TestLogMessage_size];
+  for (const TestLogMessage& msg : {worst, small}) {
+    size_t expected = 0;
+    size_t written = 0;
+    ASSERT_TRUE(metadata->encoded_size(&msg, &expected));
+    ASSERT_TRUE(metadata->encode(&msg, buffer, sizeof(buffer), &written));
+    EXPECT_EQ(written, expected);
+  }
+  size_t worst_size = 0;
+  metadata->encoded_size(&worst, &worst_size);
+  EXPECT_EQ(worst_size, TestLogMessage_size);
+
+  size_t ignored = 0;
+  EXPECT_FALSE(MREQ_GET_METADATA(test_topic_1)->encoded_size(&worst, &ignored));
+}
@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "test_messages.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(MultiProducerTopicTest, PublishRead) {
+    mreq::MultiProducerTopic<TestMessage1, 4> topic;
+    auto token = topic.subscribe().value();
+    EXPECT_FALSE(topic.check(token));
+
+    topic.publish({1, 1.5f, 10});
+    ASSERT_TRUE(topic.check(token));
+
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 1);
+    EXPECT_EQ(msg->timestamp, 10u);
+    EXPECT_FALSE(topic.check(token));
+    EXPECT_FALSE(topic.read(token).has_value());
+}
+
+TEST(MultiProducerTopicTest, RingBufferOverrun) {
+    mreq::MultiProducerTopic<TestMessage2, 5> topic;
+    auto token = topic.subscribe().value();
+
+    for (int i = 0; i < 7; ++i) {
+        topic.publish({(double)i, false, {}, (uint64_t)i});
+    }
+
+    TestMessage2 out[8];
+    size_t count = topic.read_multiple(token, out, 8);
+    ASSERT_EQ(count, 5);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(out[i].value1, static_cast<double>(i + 2));
+    }
+}
+
+TEST(MultiProducerTopicTest, MetadataFunctionTable) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_mp_topic);
+    auto token = meta->subscribe().value();
+
+    TestMessage1 msg{77, 0.0f, 1};
+    meta->publish(&msg);
+    ASSERT_TRUE(meta->check(token));
+
+    auto read = meta->read<TestMessage1>(token);
+    ASSERT_TRUE(read.has_value());
+    EXPECT_EQ(read->value1, 77);
+    meta->unsubscribe(token);
+}
+
+TEST(MultiProducerTopicTest, ConcurrentProducersKeepPerProducerOrder) {
+    static mreq::MultiProducerTopic<TestMessage1, 64> topic;
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 5000;
+
+    auto token = topic.subscribe().value();
+    std::atomic<bool> done{false};
+    bool ordered = true;
+    size_t received = 0;
+
+    std::thread consumer([&] {
+        int64_t last[kProducers];
+        std::fill(std::begin(last), std::end(last), -1);
+        auto drain = [&] {
+            while (auto msg = topic.read(token)) {
+                const int producer = msg->value1;
+                const int64_t counter = static_cast<int64_t>(msg->timestamp);
+                if (producer < 0 || producer >= kProducers || counter <= last[producer]) {
+                    ordered = false;
+                } else {
+                    last[producer] = counter;
+                }
+                ++received;
+            }
+        };
+        while (!done.load()) drain();
+        drain();
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                topic.publish({p, 0.0f, static_cast<uint64_t>(i)});
+            }
+        });
+    }
+    for (auto& t : producers) t.join();
+    done = true;
+    consumer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_GT(received, 0u);
+    EXPECT_LE(received, static_cast<size_t>(kProducers * kPerProducer));
+}
+
+TEST(MultiProducerTopicTest, PublishMultipleThroughMetadata) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_mp_topic);
+    auto token = meta->subscribe().value();
+
+    TestMessage1 batch[5];
+    for (int i = 0; i < 5; ++i) batch[i] = {i, 0.0f, 0};
+    meta->publish_multiple(batch, 5);
+
+    TestMessage1 out[8];
+    ASSERT_EQ(meta->read_multiple(token, out, 8), 5u);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(out[i].value1, i);
+    meta->unsubscribe(token);
+}
@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "test_messages.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+template<typename MutexT>
+class MutexPolicyTest : public ::testing::Test {};
+
+using MutexPolicies = ::testing::Types<mreq::PthreadMutex, mreq::AdaptiveMutex, mreq::PriorityInheritMutex>;
+TYPED_TEST_SUITE(MutexPolicyTest, MutexPolicies);
+
+TYPED_TEST(MutexPolicyTest, TryLock) {
+    TypeParam mtx;
+    ASSERT_TRUE(mtx.try_lock());
+
+    bool acquired = true;
+    std::thread other([&] { acquired = mtx.try_lock(); });
+    other.join();
+    EXPECT_FALSE(acquired);
+
+    mtx.unlock();
+    ASSERT_TRUE(mtx.try_lock());
+    mtx.unlock();
+}
+
+// Uyuyan bekleyenler unlock() ile uyandırılmalı ve artışlar kaybolmamalı
+TYPED_TEST(MutexPolicyTest, MutualExclusion) {
+    constexpr int kThreads = 4;
+    constexpr int kIterations = 20000;
+    TypeParam mtx;
+    uint64_t counter = 0;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < kIterations; ++i) {
+                mtx.lock();
+                ++counter;
+                // Kilidi tutarken CPU'yu bırakmak diğer thread'leri yavaş yola (futex) düşürür
+                if (i % 512 == 0) std::this_thread::yield();
+                mtx.unlock();
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(counter, static_cast<uint64_t>(kThreads) * kIterations);
+}
+
+TYPED_TEST(MutexPolicyTest, TopicPublishRead) {
+    mreq::Topic<TestMessage1, 4, MREQ_MAX_SUBSCRIBERS, TypeParam> topic;
+    auto token = topic.subscribe().value();
+
+    topic.publish({1, 1.5f, 10});
+    topic.publish({2, 2.5f, 20});
+
+    auto first = topic.read(token);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->value1, 1);
+    auto second = topic.read(token);
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->timestamp, 20u);
+    EXPECT_FALSE(topic.check(token));
+}
+
+TEST(MutexPolicyTest, PriorityInheritanceAttribute) {
+    mreq::PriorityInheritMutex pi;
+    mreq::PthreadMutex plain;
+    EXPECT_FALSE(plain.priority_inheritance());
+#if defined(__linux__)
+    EXPECT_TRUE(pi.priority_inheritance());
+#endif
+}
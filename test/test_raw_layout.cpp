@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "mreq/log_format.hpp"
+#include "test_messages.hpp"
+
+namespace {
+
+// Aynı alanlar, farklı sıra: boyut aynı, yerleşim farklı
+struct LayoutA {
+    int32_t count;
+    float scale;
+};
+#define LayoutA_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, INT32,    count,             1) \
+X(a, STATIC,   SINGULAR, FLOAT,    scale,             2)
+
+struct LayoutB {
+    float scale;
+    int32_t count;
+};
+#define LayoutB_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, FLOAT,    scale,             2) \
+X(a, STATIC,   SINGULAR, INT32,    count,             1)
+
+// oneof alanları nanopb'nin (union, üye, tam ad) demetiyle verilir
+struct LayoutOneof {
+    pb_size_t which_payload;
+    union {
+        int32_t as_int;
+        float as_float;
+    } payload;
+};
+#define LayoutOneof_FIELDLIST(X, a) \
+X(a, STATIC,   ONEOF,    INT32,    (payload,as_int,payload.as_int),   1) \
+X(a, STATIC,   ONEOF,    FLOAT,    (payload,as_float,payload.as_float), 2)
+
+} // namespace
+
+MREQ_RAW_LAYOUT(LayoutA)
+MREQ_RAW_LAYOUT(LayoutB)
+MREQ_RAW_LAYOUT(LayoutOneof)
+
+TEST(RawLayoutTest, FingerprintReflectsLayout) {
+    static_assert(mreq::raw_fingerprint<LayoutA>() != 0, "");
+    static_assert(mreq::raw_fingerprint<LayoutOneof>() != 0, "");
+    static_assert(mreq::raw_fingerprint<LayoutA>() != mreq::raw_fingerprint<LayoutB>(),
+                  "alan sırası parmak izine girmeli");
+    static_assert(mreq::raw_fingerprint<TestMessage1>() == 0, "işaretlenmemiş tip ham moda açık olmamalı");
+
+    EXPECT_TRUE(MREQ_GET_METADATA(test_log_topic)->raw_capable());
+    EXPECT_EQ(MREQ_GET_METADATA(test_log_topic)->abi_fingerprint, mreq::raw_fingerprint<TestLogMessage>());
+    EXPECT_FALSE(MREQ_GET_METADATA(test_topic_1)->raw_capable());
+}
+
+TEST(RawLayoutTest, RawFrameRoundTrip) {
+    const mreq::mreq_metadata& meta = *MREQ_GET_METADATA(test_log_topic);
+    alignas(8) uint8_t buffer[128];
+    const TestLogMessage msg{-7, 123456789u, 2.5f};
+    const size_t written = mreq::log::encode_frame(meta, &msg, 3, 99, buffer, sizeof(buffer),
+                                                   mreq::log::Encoding::Raw);
+    ASSERT_EQ(written, mreq::log::frame_size(sizeof(uint64_t) + sizeof(TestLogMessage)));
+
+    size_t offset = 0;
+    mreq::log::Frame frame{};
+    ASSERT_TRUE(mreq::log::next_frame(buffer, written, offset, frame));
+    EXPECT_EQ(frame.header.magic, mreq::log::kRawFrameMagic);
+    EXPECT_EQ(frame.header.sequence, 3u);
+
+    TestLogMessage out{};
+    ASSERT_TRUE(mreq::log::decode_frame(meta, frame, &out));
+    EXPECT_EQ(out.value, -7);
+    EXPECT_EQ(out.timestamp, 123456789u);
+    EXPECT_FLOAT_EQ(out.reading, 2.5f);
+}
+
+TEST(RawLayoutTest, MismatchedFingerprintIsRejectedAndNanopbIsFallback) {
+    const mreq::mreq_metadata& meta = *MREQ_GET_METADATA(test_log_topic);
+    alignas(8) uint8_t buffer[128];
+    const TestLogMessage msg{42, 1u, 0.5f};
+    const size_t written = mreq::log::encode_frame(meta, &msg, 1, 1, buffer, sizeof(buffer),
+                                                   mreq::log::Encoding::Raw);
+    size_t offset = 0;
+    mreq::log::Frame frame{};
+    ASSERT_TRUE(mreq::log::next_frame(buffer, written, offset, frame));
+
+    // Karşı uç farklı ABI ile derlenmiş gibi
+    mreq::mreq_metadata other = meta;
+    other.abi_fingerprint ^= 0x10;
+    TestLogMessage out{};
+    EXPECT_FALSE(mreq::log::decode_frame(other, frame, &out));
+
+    // Ham yerleşimi olmayan topic'te Raw istense de nanopb çerçevesi üretilir
+    other.abi_fingerprint = 0;
+    const size_t nanopb = mreq::log::encode_frame(other, &msg, 2, 2, buffer, sizeof(buffer),
+                                                  mreq::log::Encoding::Raw);
+    offset = 0;
+    ASSERT_TRUE(mreq::log::next_frame(buffer, nanopb, offset, frame));
+    EXPECT_EQ(frame.header.magic, mreq::log::kFrameMagic);
+    ASSERT_TRUE(mreq::log::decode_frame(meta, frame, &out));
+    EXPECT_EQ(out.value, 42);
+}
@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "mreq/platform/posix/recorder.hpp"
+#include "test_messages.hpp"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+std::string log_path(const char* name) {
+    return ::testing::TempDir() + "mreq_" + name + "_" + std::to_string(getpid());
+}
+
+std::vector<uint8_t> read_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+TEST(RecorderTest, WritesDecodableFrames) {
+    const std::string path = log_path("rec");
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_log_topic);
+    {
+        mreq::Recorder recorder;
+        mreq::RecorderConfig config;
+        config.path = path.c_str();
+        config.file_size = 64 * 1024;
+        ASSERT_TRUE(recorder.open(config));
+        ASSERT_TRUE(recorder.add(meta->message_id));
+        // nanopb tanımlayıcısı olmayan topic kaydedilemez
+        EXPECT_FALSE(recorder.add(MREQ_GET_METADATA(test_topic_1)));
+
+        for (int i = 1; i <= 5; ++i) {
+            test_log_topic_topic_instance.publish({i, static_cast<uint64_t>(i * 10), 0.5f * i});
+        }
+        EXPECT_EQ(recorder.poll(), 5u);
+        EXPECT_EQ(recorder.poll(), 0u);
+        EXPECT_EQ(recorder.errors(), 0u);
+    }
+
+    // Kapatılınca dosya yazılan boyuta kırpılır
+    const std::vector<uint8_t> data = read_file(path + ".0");
+    size_t offset = mreq::log::parse_file_header(data.data(), data.size());
+    ASSERT_EQ(offset, sizeof(mreq::log::FileHeader));
+
+    mreq::log::Frame frame{};
+    int expected = 1;
+    uint64_t last_sequence = 0;
+    while (mreq::log::next_frame(data.data(), data.size(), offset, frame)) {
+        EXPECT_EQ(frame.header.message_id, meta->message_id);
+        EXPECT_GT(frame.header.sequence, last_sequence);
+        last_sequence = frame.header.sequence;
+        TestLogMessage msg{};
+        ASSERT_TRUE(meta->decode(frame.payload, frame.header.length, &msg));
+        EXPECT_EQ(msg.value, expected);
+        EXPECT_EQ(msg.timestamp, static_cast<uint64_t>(expected * 10));
+        ++expected;
+    }
+    EXPECT_EQ(expected, 6);
+    EXPECT_EQ(offset, data.size());
+    unlink((path + ".0").c_str());
+}
+
+TEST(RecorderTest, RotatesFiles) {
+    const std::string path = log_path("rot");
+    mreq::Recorder recorder;
+    mreq::RecorderConfig config;
+    config.path = path.c_str();
+    config.file_size = sizeof(mreq::log::FileHeader) + 2 * mreq::log::frame_size(16);
+    config.max_files = 2;
+    ASSERT_TRUE(recorder.open(config));
+    ASSERT_TRUE(recorder.add(MREQ_GET_METADATA(test_log_topic)));
+
+    for (int i = 0; i < 8; ++i) {
+        test_log_topic_topic_instance.publish({i, 1, 1.0f});
+    }
+    EXPECT_EQ(recorder.poll(), 8u);
+    EXPECT_GE(recorder.file_index(), 3u);
+    recorder.close();
+
+    // Sadece son max_files dosya kalır
+    const size_t last = recorder.file_index();
+    EXPECT_EQ(access((path + "." + std::to_string(last - 2)).c_str(), F_OK), -1);
+    for (size_t i = last - 1; i <= last; ++i) {
+        const std::string name = path + "." + std::to_string(i);
+        EXPECT_EQ(access(name.c_str(), F_OK), 0);
+        unlink(name.c_str());
+    }
+}
+
+TEST(RecorderTest, EncodeFailureDoesNotRotate) {
+    const std::string path = log_path("enc");
+    mreq::Recorder recorder;
+    mreq::RecorderConfig config;
+    config.path = path.c_str();
+    config.file_size = sizeof(mreq::log::FileHeader) + 4 * mreq::log::frame_size(16);
+    ASSERT_TRUE(recorder.open(config));
+    ASSERT_TRUE(recorder.add(MREQ_GET_METADATA(test_name_topic)));
+
+    TestNameMessage good{};
+    std::memcpy(good.name, "ok", 3);
+    TestNameMessage bad;
+    std::memset(bad.name, 'x', sizeof(bad.name));   // Sonlandırılmamış string kodlanamaz
+
+    // Kodlanamayan mesajlar dosyayı değiştirmez; sadece dolan dosya değiştirilir
+    for (int i = 0; i < 3; ++i) {
+        test_name_topic_topic_instance.publish(good);
+        test_name_topic_topic_instance.publish(bad);
+    }
+    EXPECT_EQ(recorder.poll(), 3u);
+    EXPECT_EQ(recorder.errors(), 3u);
+    EXPECT_EQ(recorder.file_index(), 0u);
+
+    test_name_topic_topic_instance.publish(good);
+    test_name_topic_topic_instance.publish(good);
+    EXPECT_EQ(recorder.poll(), 2u);
+    EXPECT_EQ(recorder.errors(), 3u);
+    EXPECT_EQ(recorder.file_index(), 1u);
+    recorder.close();
+
+    for (size_t i = 0; i <= 1; ++i) {
+        unlink((path + "." + std::to_string(i)).c_str());
+    }
+}
+
+TEST(RecorderTest, BackgroundThreadDrainsPublishers) {
+    const std::string path = log_path("bg");
+    mreq::Recorder recorder;
+    mreq::RecorderConfig config;
+    config.path = path.c_str();
+    config.file_size = 1024 * 1024;
+    ASSERT_TRUE(recorder.open(config));
+    ASSERT_TRUE(recorder.add(MREQ_GET_METADATA(test_log_mp_topic)));
+    ASSERT_TRUE(recorder.start(1));
+
+    constexpr int kMessages = 2000;
+    std::thread producer([] {
+        for (int i = 0; i < kMessages; ++i) {
+            test_log_mp_topic_topic_instance.publish({i, 0, 0.0f});
+        }
+    });
+    producer.join();
+    recorder.stop();
+
+    // Publisher hiç beklemez: recorder yetişemediği mesajları dropped() ile bildirir
+    EXPECT_EQ(recorder.frames_written() + recorder.dropped(), static_cast<uint64_t>(kMessages));
+    EXPECT_GT(recorder.frames_written(), 0u);
+    recorder.close();
+    unlink((path + ".0").c_str());
+}
@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
 #include "mreq/mreq.hpp"
 #include "test_messages.hpp"
+#include "mreq/perfect_hash.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 
 TEST(RegistryTest, TopicRegistration) {
     auto *metadata1 = MREQ_GET_METADATA(test_topic_1);
@@ -25,4 +30,96 @@ TEST(RegistryTest, FindNonExistentTopic) {
 TEST(RegistryTest, RegistrySize) {
     // test_main.cpp'de 3 topic tanımlandığı için boyutun en az 3 olmasını bekliyoruz.
     EXPECT_GE(mreq::TopicRegistry::instance().size(), 3);
-}
\ No newline at end of file
+}
+TEST(RegistryTest, PerfectHashHelpers) {
+    constexpr size_t ids[] = {mreq::constexpr_hash("sensor_accel"), mreq::constexpr_hash("sensor_baro")};
+    static_assert(mreq::message_ids_unique(ids, 2), "distinct topic names must not collide");
+
+    // djb2 ile bilinen 32-bit çakışma: alt 32 bit karşılaştırılır
+    constexpr size_t colliding[] = {mreq::constexpr_hash("hetairas"), mreq::constexpr_hash("mentioner")};
+    EXPECT_FALSE(mreq::message_ids_unique(colliding, 2));
+
+    // shift = 32 tek slotlu tabloya karşılık gelir
+    EXPECT_EQ(mreq::perfect_hash_slot(ids[0], 1u, 32), 0u);
+    EXPECT_LT(mreq::perfect_hash_slot(ids[1], 0x9e3779b1u, 30), 4u);
+}
+
+// Registry süreç genelindedir: test sonunda eklenen (fonksiyon tablosu olmayan) girdiler
+// truncate() ile silinir, registry'yi dolaşan sonraki testler onları görmez
+TEST(RegistryTest, LateRegistrationWithConcurrentLookups) {
+    auto& registry = mreq::TopicRegistry::instance();
+    const size_t initial = registry.size();
+    struct RestoreRegistry {
+        mreq::TopicRegistry& registry;
+        size_t count;
+        ~RestoreRegistry() { registry.truncate(count); }
+    } restore{registry, initial};
+    const size_t to_add = std::min<size_t>(512, registry.capacity() - initial);
+
+    static std::vector<std::string> names;
+    static std::vector<mreq::mreq_metadata> metas;
+    names.clear();
+    metas.assign(to_add, mreq::mreq_metadata{});
+    for (size_t i = 0; i < to_add; ++i) {
+        names.push_back("late_topic_" + std::to_string(i));
+    }
+    for (size_t i = 0; i < to_add; ++i) {
+        metas[i].topic_name = names[i].c_str();
+        metas[i].message_id = mreq::constexpr_hash(names[i].c_str());
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> lookup_failed{false};
+    const size_t static_id = MREQ_GET_METADATA(test_topic_1)->message_id;
+    std::thread reader([&] {
+        while (!done.load()) {
+            // Önceden kayıtlı topic her zaman bulunmalı
+            if (mreq::find_topic_metadata(static_id) != MREQ_GET_METADATA(test_topic_1)) {
+                lookup_failed = true;
+            }
+            // Sıra ile yayınlanan girdiler tutarlı olmalı
+            const size_t count = registry.size();
+            if (count > 0 && registry.get_topic_by_index(count - 1) == nullptr) {
+                lookup_failed = true;
+            }
+        }
+    });
+
+    // reader join edilmeden ASSERT ile çıkılmamalı (joinable std::thread terminate eder)
+    size_t registered = 0;
+    for (size_t i = 0; i < to_add; ++i) {
+        registered += mreq::register_topic_metadata(&metas[i]);
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(registered, to_add);
+
+    EXPECT_FALSE(lookup_failed.load());
+    EXPECT_EQ(registry.size(), initial + to_add);
+    for (size_t i = 0; i < to_add; ++i) {
+        EXPECT_EQ(mreq::find_topic_metadata(metas[i].message_id), &metas[i]);
+    }
+    // Aynı ID ikinci kez kaydedilemez
+    if (to_add > 0) {
+        EXPECT_FALSE(mreq::register_topic_metadata(&metas[0]));
+    }
+}
+
+TEST(RegistryTest, TruncateRemovesLateRegistrations) {
+    auto& registry = mreq::TopicRegistry::instance();
+    const size_t initial = registry.size();
+    static mreq::mreq_metadata late{};
+    late.topic_name = "late_truncated_topic";
+    late.message_id = mreq::constexpr_hash("late_truncated_topic");
+
+    ASSERT_TRUE(mreq::register_topic_metadata(&late));
+    registry.truncate(initial);
+    EXPECT_EQ(registry.size(), initial);
+    EXPECT_EQ(mreq::find_topic_metadata(late.message_id), nullptr);
+    // Önceden kayıtlı girdiler yeniden kurulan tabloda bulunur
+    EXPECT_EQ(mreq::find_topic_metadata(MREQ_GET_METADATA(test_topic_1)->message_id),
+              MREQ_GET_METADATA(test_topic_1));
+    EXPECT_EQ(mreq::find_topic_metadata(MREQ_GET_METADATA(test_topic_3)->message_id),
+              MREQ_GET_METADATA(test_topic_3));
+}
@@ -0,0 +1,168 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "mreq/platform/posix/recorder.hpp"
+#include "mreq/platform/posix/replay.hpp"
+#include "test_messages.hpp"
+#include <string>
+#include <vector>
+#include <fstream>
+
+namespace {
+
+std::string log_path(const char* name) {
+    return ::testing::TempDir() + "mreq_" + name + "_" + std::to_string(getpid());
+}
+
+// timestamps_ms[i] anında kaydedilmiş gibi çerçeveler içeren bir log dosyası yazar
+void write_log(const std::string& path, const mreq::mreq_metadata& meta,
+               const std::vector<uint64_t>& timestamps_ms) {
+    std::vector<uint8_t> data(sizeof(mreq::log::FileHeader) + timestamps_ms.size() * 128);
+    const mreq::log::FileHeader header = mreq::log::make_file_header(0);
+    std::memcpy(data.data(), &header, sizeof(header));
+    size_t offset = sizeof(header);
+    for (size_t i = 0; i < timestamps_ms.size(); ++i) {
+        TestLogMessage msg{static_cast<int32_t>(i), timestamps_ms[i], 0.0f};
+        offset += mreq::log::encode_frame(meta, &msg, i + 1, timestamps_ms[i] * 1000000u,
+                                          data.data() + offset, data.size() - offset);
+    }
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(data.data()), offset);
+}
+
+} // namespace
+
+TEST(ReplayTest, RoundTripThroughRecorder) {
+    const std::string path = log_path("replay");
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_log_topic);
+    {
+        mreq::Recorder recorder;
+        mreq::RecorderConfig config;
+        config.path = path.c_str();
+        config.file_size = sizeof(mreq::log::FileHeader) + 4 * mreq::log::frame_size(16);
+        ASSERT_TRUE(recorder.open(config));
+        ASSERT_TRUE(recorder.add(meta));
+        for (int i = 0; i < 10; ++i) {
+            test_log_topic_topic_instance.publish({i, static_cast<uint64_t>(i), 1.5f});
+        }
+        ASSERT_EQ(recorder.poll(), 10u);
+    }
+
+    auto token = meta->subscribe().value();
+    mreq::Replayer replayer(mreq::Replayer::Mode::AsFastAsPossible);
+    EXPECT_EQ(replayer.play_rotated(path.c_str()), 10u);
+    EXPECT_EQ(replayer.errors(), 0u);
+    EXPECT_GT(replayer.now_ns(), 0u);
+
+    TestLogMessage out[16];
+    ASSERT_EQ(meta->read_multiple(token, out, 16), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(out[i].value, i);
+        EXPECT_FLOAT_EQ(out[i].reading, 1.5f);
+    }
+    meta->unsubscribe(token);
+    for (int i = 0; i < 3; ++i) unlink((path + "." + std::to_string(i)).c_str());
+}
+
+TEST(ReplayTest, RawRecordingRoundTrip) {
+    const std::string path = log_path("raw");
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_log_topic);
+    {
+        mreq::Recorder recorder;
+        mreq::RecorderConfig config;
+        config.path = path.c_str();
+        config.encoding = mreq::log::Encoding::Raw;
+        ASSERT_TRUE(recorder.open(config));
+        ASSERT_TRUE(recorder.add(meta));
+        for (int i = 0; i < 5; ++i) {
+            test_log_topic_topic_instance.publish({-i, static_cast<uint64_t>(i), 0.25f});
+        }
+        ASSERT_EQ(recorder.poll(), 5u);
+        EXPECT_EQ(recorder.bytes_written(),
+                  5 * mreq::log::frame_size(sizeof(uint64_t) + sizeof(TestLogMessage)));
+    }
+
+    auto token = meta->subscribe().value();
+    mreq::Replayer replayer;
+    EXPECT_EQ(replayer.play((path + ".0").c_str()), 5u);
+    EXPECT_EQ(replayer.errors(), 0u);
+
+    TestLogMessage out[8];
+    ASSERT_EQ(meta->read_multiple(token, out, 8), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(out[i].value, -i);
+        EXPECT_FLOAT_EQ(out[i].reading, 0.25f);
+    }
+    meta->unsubscribe(token);
+    unlink((path + ".0").c_str());
+}
+
+TEST(ReplayTest, VirtualClockAndRealTimePacing) {
+    const std::string path = log_path("pacing");
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_log_topic);
+    write_log(path, *meta, {1000, 1040, 1080});
+
+    // Beklemeden oynatılır, sanal saat kayıt zamanını izler
+    mreq::LogReader reader;
+    ASSERT_TRUE(reader.open(path.c_str()));
+    mreq::Replayer fast;
+    mreq::log::Frame frame{};
+    ASSERT_TRUE(reader.next(frame));
+    ASSERT_TRUE(fast.publish(frame));
+    EXPECT_EQ(fast.now_ns(), 1000000000u);
+    const uint64_t start = mreq::monotonic_ns();
+    EXPECT_EQ(fast.play(reader), 2u);
+    EXPECT_LT(mreq::monotonic_ns() - start, 40000000u);
+    EXPECT_EQ(fast.now_ns(), 1080000000u);
+
+    // Gerçek zamanlı: 80 ms kayıt, 2x hızda en az 40 ms sürer
+    mreq::Replayer paced(mreq::Replayer::Mode::RealTime, 2.0);
+    const uint64_t paced_start = mreq::monotonic_ns();
+    EXPECT_EQ(paced.play(path.c_str()), 3u);
+    EXPECT_GE(mreq::monotonic_ns() - paced_start, 40000000u);
+
+    // Registry'de olmayan topic atlanır
+    mreq::mreq_metadata unknown = *meta;
+    unknown.message_id = mreq::constexpr_hash("not_registered");
+    write_log(path, unknown, {0});
+    mreq::Replayer skipper;
+    EXPECT_EQ(skipper.play(path.c_str()), 0u);
+    EXPECT_EQ(skipper.unknown(), 1u);
+    unlink(path.c_str());
+}
+
+TEST(ReplayTest, FastReplayDrivesApplicationClock) {
+    const std::string path = log_path("clock");
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_log_topic);
+    std::vector<uint64_t> timestamps_ms;
+    for (uint64_t ms = 1000; ms <= 1200; ms += 10) timestamps_ms.push_back(ms);
+    write_log(path, *meta, timestamps_ms);
+
+    auto token = test_log_topic_topic_instance.subscribe(
+        mreq::SubscribeOptions::at_most_every(50'000'000)).value();
+    mreq::WaitSet ws;
+    ws.add(test_log_topic_topic_instance, token).value();
+    {
+        mreq::LogReader reader;
+        ASSERT_TRUE(reader.open(path.c_str()));
+        mreq::Replayer replayer;
+        mreq::log::Frame frame{};
+        size_t delivered = 0;
+        while (reader.next(frame)) {
+            ASSERT_TRUE(replayer.publish(frame));
+            EXPECT_EQ(mreq::now_ns(), replayer.now_ns());
+            delivered += test_log_topic_topic_instance.read(token).has_value();
+        }
+        // 200 ms'lik kayıt 50 ms aralıkla: 1000, 1050, ..., 1200 ms'deki mesajlar
+        EXPECT_EQ(delivered, 5u);
+
+        // Zaman aşımları gerçek saatle ölçülür; sanal saat durmuşken de dolar
+        size_t ready[1];
+        EXPECT_EQ(ws.wait(ready, 1, 10), 0u);
+    }
+    // Replayer yok edilince monoton saate dönülür
+    const uint64_t now = mreq::now_ns();
+    EXPECT_NE(now, 1200000000u);
+    EXPECT_LE(now, mreq::monotonic_ns());
+
+    test_log_topic_topic_instance.unsubscribe(token);
+    unlink(path.c_str());
+}
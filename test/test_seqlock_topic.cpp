@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "test_messages.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(SeqlockTopicTest, PublishRead) {
+    mreq::SeqlockTopic<TestMessage1, 1> topic;
+    auto token_opt = topic.subscribe();
+    ASSERT_TRUE(token_opt.has_value());
+    auto token = token_opt.value();
+
+    EXPECT_FALSE(topic.check(token));
+
+    TestMessage1 msg_sent{123, 45.6f, 789};
+    topic.publish(msg_sent);
+
+    ASSERT_TRUE(topic.check(token));
+    auto msg_read_opt = topic.read(token);
+    ASSERT_TRUE(msg_read_opt.has_value());
+    EXPECT_EQ(msg_read_opt.value().value1, msg_sent.value1);
+    EXPECT_FLOAT_EQ(msg_read_opt.value().value2, msg_sent.value2);
+    EXPECT_EQ(msg_read_opt.value().timestamp, msg_sent.timestamp);
+
+    EXPECT_FALSE(topic.check(token));
+    EXPECT_FALSE(topic.read(token).has_value());
+
+    topic.unsubscribe(token);
+}
+
+TEST(SeqlockTopicTest, RingBufferOverrun) {
+    mreq::SeqlockTopic<TestMessage2, 5> topic;
+    auto token = topic.subscribe().value();
+
+    for (int i = 0; i < 7; ++i) {
+        topic.publish({(double)i, false, {}, (uint64_t)i});
+    }
+
+    TestMessage2 out[8];
+    size_t count = topic.read_multiple(token, out, 8);
+    ASSERT_EQ(count, 5);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(out[i].value1, static_cast<double>(i + 2));
+    }
+    EXPECT_FALSE(topic.check(token));
+}
+
+TEST(SeqlockTopicTest, SubscribeSkipsOldMessages) {
+    mreq::SeqlockTopic<TestMessage1, 4> topic;
+    topic.publish({1, 0.0f, 1});
+
+    auto token = topic.subscribe().value();
+    EXPECT_FALSE(topic.check(token));
+
+    topic.publish({2, 0.0f, 2});
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 2);
+}
+
+TEST(SeqlockTopicTest, ConcurrentReadersNeverSeeTornMessages) {
+    static mreq::SeqlockTopic<TestMessage3, 4> topic;
+    constexpr uint64_t kMessages = 20000;
+
+    std::atomic<bool> torn{false};
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+
+    for (int r = 0; r < 3; ++r) {
+        auto token = topic.subscribe().value();
+        readers.emplace_back([token, &torn, &done] {
+            uint64_t last = 0;
+            auto drain = [&] {
+                while (auto msg = topic.read(token)) {
+                    for (uint8_t byte : msg->data) {
+                        if (byte != static_cast<uint8_t>(msg->timestamp)) torn = true;
+                    }
+                    if (msg->timestamp <= last) torn = true; // Sıra korunmalı
+                    last = msg->timestamp;
+                }
+            };
+            while (!done.load()) drain();
+            drain();
+        });
+    }
+
+    for (uint64_t i = 1; i <= kMessages; ++i) {
+        TestMessage3 msg{};
+        std::fill(std::begin(msg.data), std::end(msg.data), static_cast<uint8_t>(i));
+        msg.timestamp = i;
+        topic.publish(msg);
+    }
+    done = true;
+
+    for (auto& t : readers) t.join();
+    EXPECT_FALSE(torn.load());
+}
+
+TEST(SeqlockTopicTest, LoanCommit) {
+    mreq::SeqlockTopic<TestMessage1, 2> topic;
+    auto token = topic.subscribe().value();
+
+    auto slot = topic.loan();
+    slot->value1 = 5;
+    slot->timestamp = 6;
+    EXPECT_FALSE(topic.check(token));
+    slot.commit();
+
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 5);
+    EXPECT_EQ(msg->timestamp, 6u);
+}
+
+TEST(SeqlockTopicTest, PublishMultiple) {
+    mreq::SeqlockTopic<TestMessage1, 4> topic;
+    auto token = topic.subscribe().value();
+
+    TestMessage1 batch[6];
+    for (int i = 0; i < 6; ++i) batch[i] = {i + 1, 0.0f, 0};
+    topic.publish_multiple(batch, 3);
+    topic.publish_multiple(batch + 3, 3);
+
+    mreq::ReadInfo info;
+    TestMessage1 out[8];
+    ASSERT_EQ(topic.read_multiple(token, out, 8, info), 4u);
+    EXPECT_EQ(out[0].value1, 3);
+    EXPECT_EQ(out[3].value1, 6);
+    EXPECT_EQ(info.dropped, 2u);
+}
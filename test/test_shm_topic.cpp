@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "mreq/platform/posix/shm_topic.hpp"
+#include "test_messages.hpp"
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+// Paralel test süreçleri birbirinin segmentine dokunmasın
+size_t unique_id(size_t salt) {
+    return (static_cast<size_t>(getpid()) << 8) ^ salt ^ 0x5A5A0000u;
+}
+
+} // namespace
+
+TEST(ShmTopicTest, TwoInstancesShareRing) {
+    const size_t id = unique_id(1);
+    mreq::ShmTopic<TestMessage1, 4> writer;
+    mreq::ShmTopic<TestMessage1, 4> reader;
+    ASSERT_TRUE(writer.open(id));
+    ASSERT_TRUE(reader.open(id));
+
+    auto token = reader.subscribe().value();
+    EXPECT_FALSE(reader.check(token));
+
+    writer.publish({5, 2.5f, 50});
+    ASSERT_TRUE(reader.check(token));
+    auto msg = reader.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 5);
+    EXPECT_EQ(msg->timestamp, 50u);
+    EXPECT_FALSE(reader.check(token));
+
+    // Abone tablosu da paylaşılır: diğer instance'ın aldığı slot tekrar verilmez
+    auto other = writer.subscribe().value();
+    EXPECT_NE(other, token);
+
+    mreq::ShmTopic<TestMessage1, 4>::unlink(id);
+}
+
+TEST(ShmTopicTest, LayoutMismatchFailsToOpen) {
+    const size_t id = unique_id(2);
+    mreq::ShmTopic<TestMessage1, 4> topic;
+    ASSERT_TRUE(topic.open(id));
+
+    mreq::ShmTopic<TestMessage1, 8> other_capacity;
+    EXPECT_FALSE(other_capacity.open(id));
+    EXPECT_FALSE(other_capacity.subscribe().has_value());
+
+    mreq::ShmTopic<TestMessage1, 4>::unlink(id);
+}
+
+TEST(ShmTopicTest, CrossProcessPublishRead) {
+    const size_t id = unique_id(3);
+    mreq::ShmTopic<TestMessage1, 16> topic;
+    ASSERT_TRUE(topic.open(id));
+    auto token = topic.subscribe().value();
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        // Çocuk süreç segmenti kendi eşlemesiyle açar ve yayınlar
+        mreq::ShmTopic<TestMessage1, 16> child;
+        if (!child.open(id)) _exit(1);
+        for (int i = 0; i < 10; ++i) {
+            child.publish({i, 0.0f, static_cast<uint64_t>(i)});
+        }
+        _exit(0);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    TestMessage1 out[16];
+    ASSERT_EQ(topic.read_multiple(token, out, 16), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(out[i].value1, i);
+    }
+
+    mreq::ShmTopic<TestMessage1, 16>::unlink(id);
+}
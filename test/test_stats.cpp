@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "test_messages.hpp"
+
+TEST(StatsTest, TopicCountsPublishReadAndLost) {
+    mreq::Topic<TestMessage1, 4> topic;
+    auto fast = topic.subscribe().value();
+    auto slow = topic.subscribe().value();
+
+    for (int i = 0; i < 6; ++i) {
+        topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+        topic.read(fast);
+    }
+
+    mreq::TopicStatsSnapshot snap{};
+    topic.stats(snap);
+    ASSERT_TRUE(snap.enabled);
+    EXPECT_EQ(snap.published, 6u);
+    EXPECT_GT(snap.last_publish_ns, 0u);
+    ASSERT_EQ(snap.subscriber_count, 2u);
+    EXPECT_EQ(snap.subscribers[1].token, slow);
+    EXPECT_EQ(snap.subscribers[1].lag, 6u);
+
+    // Yavaş abone ring'in en eski 4 mesajını okur, 2 mesaj kayıp
+    TestMessage1 out[8];
+    EXPECT_EQ(topic.read_multiple(slow, out, 8), 4u);
+
+    topic.stats(snap);
+    EXPECT_EQ(snap.subscribers[0].read, 6u);
+    EXPECT_EQ(snap.subscribers[0].lost, 0u);
+    EXPECT_EQ(snap.subscribers[1].read, 4u);
+    EXPECT_EQ(snap.subscribers[1].lost, 2u);
+    EXPECT_EQ(snap.subscribers[1].lag, 0u);
+    EXPECT_EQ(snap.read, 10u);
+    EXPECT_EQ(snap.lost, 2u);
+}
+
+TEST(StatsTest, LockFreeTopicsCountSkippedMessages) {
+    mreq::SeqlockTopic<TestMessage1, 2> topic;
+    auto token = topic.subscribe().value();
+    for (int i = 0; i < 5; ++i) {
+        topic.publish({i, 0.0f, 0});
+    }
+    ASSERT_TRUE(topic.read(token).has_value());
+
+    mreq::TopicStatsSnapshot snap{};
+    topic.stats(snap);
+    EXPECT_EQ(snap.published, 5u);
+    EXPECT_EQ(snap.subscribers[0].read, 1u);
+    EXPECT_EQ(snap.subscribers[0].lost, 3u);
+    EXPECT_EQ(snap.subscribers[0].lag, 1u);
+}
+
+TEST(StatsTest, RegistrySnapshot) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_mp_topic);
+    auto token = meta->subscribe().value();
+    TestMessage1 msg{1, 0.0f, 1};
+    meta->publish(&msg);
+
+    mreq::TopicStatsSnapshot snap{};
+    ASSERT_TRUE(mreq::TopicRegistry::instance().get_stats(meta->message_id, snap));
+    EXPECT_STREQ(snap.topic_name, "test_mp_topic");
+    EXPECT_GE(snap.published, 1u);
+    EXPECT_GE(snap.subscriber_count, 1u);
+
+    // Fonksiyon tablosu olmayan metadata'lar atlanır
+    mreq::TopicStatsSnapshot all[8];
+    size_t count = mreq::TopicRegistry::instance().get_all_stats(all, 8);
+    ASSERT_GE(count, 1u);
+    bool found = false;
+    for (size_t i = 0; i < count; ++i) {
+        found |= all[i].topic_name == meta->topic_name;
+    }
+    EXPECT_TRUE(found);
+    EXPECT_FALSE(MREQ_GET_METADATA(test_topic_1)->stats(snap));
+
+    meta->unsubscribe(token);
+}
@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+
+// MREQ_ENABLE_STATS olmadan derlenir: sayaçlar 0 kalır, abone lag'i yine doldurulur
+
+namespace {
+
+struct Sample {
+    int32_t value;
+    uint64_t timestamp;
+};
+
+template<typename TopicT>
+void expect_lag_without_counters() {
+    TopicT topic;
+    auto fast = topic.subscribe().value();
+    auto slow = topic.subscribe().value();
+    for (int i = 0; i < 3; ++i) {
+        topic.publish({i, static_cast<uint64_t>(i)});
+        topic.read(fast);
+    }
+
+    mreq::TopicStatsSnapshot snap{};
+    topic.stats(snap);
+    EXPECT_FALSE(snap.enabled);
+    EXPECT_EQ(snap.published, 0u);
+    EXPECT_EQ(snap.read, 0u);
+    EXPECT_EQ(snap.lost, 0u);
+    EXPECT_EQ(snap.last_publish_ns, 0u);
+    ASSERT_EQ(snap.subscriber_count, 2u);
+    EXPECT_EQ(snap.subscribers[0].token, fast);
+    EXPECT_EQ(snap.subscribers[0].lag, 0u);
+    EXPECT_EQ(snap.subscribers[1].token, slow);
+    EXPECT_GT(snap.subscribers[1].lag, 0u);
+    EXPECT_EQ(snap.subscribers[1].read, 0u);
+}
+
+} // namespace
+
+TEST(StatsDisabledTest, TopicFillsLagOnly) {
+    expect_lag_without_counters<mreq::Topic<Sample, 4>>();
+}
+
+TEST(StatsDisabledTest, LockFreeTopicsFillLagOnly) {
+    expect_lag_without_counters<mreq::SeqlockTopic<Sample, 4>>();
+    expect_lag_without_counters<mreq::MultiProducerTopic<Sample, 4>>();
+    expect_lag_without_counters<mreq::LatestTopic<Sample>>();
+}
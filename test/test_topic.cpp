@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "mreq/mreq.hpp"
 #include "test_messages.hpp"
+#include <chrono>
+#include <thread>
 
 // test_main.cpp'de tanımlanan global topic'lere erişim
 extern mreq::Topic<TestMessage1, 1> test_topic_1_topic_instance;
@@ -66,3 +68,470 @@ TEST(TopicTest, RingBuffer) {
     }
     EXPECT_EQ(read_count, 5);
 }
+
+TEST(TopicTest, CheckObservesPublishFromOtherThread) {
+    mreq::Topic<TestMessage1, 4> topic;
+    auto token = topic.subscribe().value();
+
+    std::thread publisher([&topic] { topic.publish({7, 0.0f, 7}); });
+    while (!topic.check(token)) {
+        std::this_thread::yield();
+    }
+    publisher.join();
+
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 7);
+    EXPECT_FALSE(topic.check(token));
+}
+
+TEST(TopicTest, LoanCommitAndReadView) {
+    mreq::Topic<TestMessage3, 2> topic;
+    auto token = topic.subscribe().value();
+
+    {
+        auto slot = topic.loan();
+        slot->data[0] = 0xAB;
+        slot->timestamp = 42;
+        slot.commit();
+    }
+    ASSERT_TRUE(topic.check(token));
+
+    {
+        auto view = topic.read_view(token);
+        ASSERT_TRUE(view);
+        EXPECT_EQ(view->data[0], 0xAB);
+        EXPECT_EQ(view->timestamp, 42u);
+    }
+    EXPECT_FALSE(topic.check(token));
+    EXPECT_FALSE(topic.read_view(token));
+
+    // View serbest bırakıldıktan sonra publish engellenmemeli
+    topic.publish({{1}, 43});
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->timestamp, 43u);
+}
+
+TEST(TopicTest, AbandonedLoanIsNotPublished) {
+    mreq::Topic<TestMessage1, 2> topic;
+    auto token = topic.subscribe().value();
+    topic.publish({1, 0.0f, 1});
+    topic.publish({2, 0.0f, 2});
+
+    {
+        auto slot = topic.loan();
+        slot->value1 = 99; // En eski mesajın (1) slotunu bozar
+    }
+
+    // Bozulan en eski mesaj atlanır, 99 hiç görülmez; kayıp dropped ile bildirilir
+    mreq::ReadInfo info;
+    auto msg = topic.read(token, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 2);
+    EXPECT_EQ(info.sequence, 2u);
+    EXPECT_EQ(info.dropped, 1u);
+    EXPECT_FALSE(topic.check(token));
+}
+
+TEST(TopicTest, AbandonedLoanReportsDropped) {
+    mreq::Topic<TestMessage1, 3> topic;
+    auto lagging = topic.subscribe().value();
+    auto batch = topic.subscribe().value();
+    auto decimated = topic.subscribe(mreq::SubscribeOptions::every(2)).value();
+    auto ahead = topic.subscribe().value();
+    for (int i = 1; i <= 4; ++i) {
+        topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+    }
+    ASSERT_TRUE(topic.read(ahead).has_value());   // 2'yi okudu (1 taşmada kayboldu)
+
+    { auto slot = topic.loan(); slot->value1 = 99; }  // Mesaj 2'nin slotu bozulur
+
+    // Taşma (1) ve terk edilen loan (2) aynı okumada bildirilir
+    mreq::ReadInfo info;
+    auto msg = topic.read(lagging, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 3);
+    EXPECT_EQ(info.sequence, 3u);
+    EXPECT_EQ(info.dropped, 2u);
+
+    TestMessage1 out[3];
+    EXPECT_EQ(topic.read_multiple(batch, out, 3, info), 2u);
+    EXPECT_EQ(out[0].value1, 3);
+    EXPECT_EQ(info.sequence, 4u);
+    EXPECT_EQ(info.dropped, 2u);
+
+    // Seyreltilmiş abone: kaybolan tek hedef 2'dir
+    msg = topic.read(decimated, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 4);
+    EXPECT_EQ(info.dropped, 1u);
+
+    msg = topic.read(ahead, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 3);
+    EXPECT_EQ(info.dropped, 0u);
+
+    mreq::TopicStatsSnapshot snap{};
+    topic.stats(snap);
+    EXPECT_EQ(snap.lost, 6u);
+}
+
+TEST(TopicTest, ReadReportsSequenceAndDropped) {
+    mreq::Topic<TestMessage1, 3> topic;
+    auto token = topic.subscribe().value();
+    for (int i = 1; i <= 5; ++i) {
+        topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+    }
+
+    // 5 mesajdan sadece son 3'ü ring'de: ilk okuma 2 kaybı bildirir
+    mreq::ReadInfo info;
+    auto msg = topic.read(token, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 3);
+    EXPECT_EQ(info.sequence, 3u);
+    EXPECT_EQ(info.dropped, 2u);
+
+    msg = topic.read(token, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(info.sequence, 4u);
+    EXPECT_EQ(info.dropped, 0u);
+
+    for (int i = 6; i <= 10; ++i) {
+        topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+    }
+    TestMessage1 out[8];
+    ASSERT_EQ(topic.read_multiple(token, out, 8, info), 3u);
+    EXPECT_EQ(out[0].value1, 8);
+    EXPECT_EQ(info.sequence, 10u);
+    EXPECT_EQ(info.dropped, 3u);
+}
+
+TEST(TopicTest, SingleSlotTopicDoesNotRepeatMessages) {
+    mreq::Topic<TestMessage1, 1> topic;
+    auto token = topic.subscribe().value();
+    topic.publish({1, 0.0f, 1});
+    topic.publish({2, 0.0f, 2});
+    topic.publish({3, 0.0f, 3});
+
+    mreq::ReadInfo info;
+    auto msg = topic.read(token, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 3);
+    EXPECT_EQ(info.dropped, 2u);
+    EXPECT_FALSE(topic.check(token));
+    EXPECT_FALSE(topic.read(token).has_value());
+}
+
+TEST(TopicTest, ReadInfoThroughMetadata) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_mp_topic);
+    auto token = meta->subscribe().value();
+    for (int i = 0; i < 10; ++i) {
+        TestMessage1 msg{i, 0.0f, 0};
+        meta->publish(&msg);
+    }
+
+    mreq::ReadInfo info;
+    auto msg = meta->read<TestMessage1>(token, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 2);
+    EXPECT_EQ(info.dropped, 2u);
+
+    TestMessage1 out[8];
+    EXPECT_EQ(meta->read_multiple(token, out, 8, info), 7u);
+    EXPECT_EQ(info.dropped, 0u);
+    EXPECT_EQ(out[6].value1, 9);
+    meta->unsubscribe(token);
+}
+
+TEST(TopicTest, PublishMultipleWrapsRing) {
+    mreq::Topic<TestMessage1, 4> topic;
+    auto token = topic.subscribe().value();
+    topic.publish({0, 0.0f, 0});
+    topic.read(token);
+
+    // head_ = 1: 3 mesaj sona, 1 mesaj başa yazılır
+    TestMessage1 batch[6];
+    for (int i = 0; i < 6; ++i) batch[i] = {i + 1, 0.0f, static_cast<uint64_t>(i + 1)};
+    topic.publish_multiple(batch, 4);
+
+    TestMessage1 out[8];
+    ASSERT_EQ(topic.read_multiple(token, out, 8), 4u);
+    for (int i = 0; i < 4; ++i) EXPECT_EQ(out[i].value1, i + 1);
+
+    // Kapasiteden büyük burst: son N mesaj kalır, kayıp bildirilir
+    topic.publish_multiple(batch, 6);
+    mreq::ReadInfo info;
+    ASSERT_EQ(topic.read_multiple(token, out, 8, info), 4u);
+    EXPECT_EQ(out[0].value1, 3);
+    EXPECT_EQ(out[3].value1, 6);
+    EXPECT_EQ(info.dropped, 2u);
+    EXPECT_EQ(info.sequence, 11u);
+
+    // Sonraki tekil publish doğru slottan devam eder
+    topic.publish({7, 0.0f, 7});
+    auto msg = topic.read(token);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 7);
+}
+
+TEST(TopicTest, ReadSpansCoverWrapPoint) {
+    mreq::Topic<TestMessage1, 4> topic;
+    auto token = topic.subscribe().value();
+    for (int i = 1; i <= 3; ++i) topic.publish({i, 0.0f, 0});
+    ASSERT_TRUE(topic.read(token).has_value());
+
+    // Okunmamış 2..6 ring kapasitesini aşar: 2 kaçırılır, 3-4 ring sonunda, 5-6 başta
+    for (int i = 4; i <= 6; ++i) topic.publish({i, 0.0f, 0});
+    mreq::ReadInfo info;
+    {
+        auto spans = topic.read_spans(token, info);
+        ASSERT_TRUE(spans);
+        ASSERT_EQ(spans.size(), 4u);
+        EXPECT_EQ(info.dropped, 1u);
+        EXPECT_EQ(info.sequence, 6u);
+        int expected = 3;
+        for (const auto& msg : spans.first()) EXPECT_EQ(msg.value1, expected++);
+        for (const auto& msg : spans.second()) EXPECT_EQ(msg.value1, expected++);
+        EXPECT_EQ(expected, 7);
+        EXPECT_EQ(spans.first().size, 2u);
+    }
+
+    EXPECT_FALSE(topic.read_spans(token));
+    topic.publish({7, 0.0f, 0});
+    auto spans = topic.read_spans(token);
+    ASSERT_EQ(spans.size(), 1u);
+    EXPECT_EQ(spans.first().data->value1, 7);
+    EXPECT_TRUE(spans.second().empty());
+}
+
+TEST(TopicTest, SubscribeAfterPublishStartsAtNextMessage) {
+    mreq::Topic<TestMessage1, 4> topic;
+    topic.publish({1, 0.0f, 0});
+    topic.publish({2, 0.0f, 0});
+    auto token = topic.subscribe().value();
+    EXPECT_FALSE(topic.read(token).has_value());
+
+    topic.publish({3, 0.0f, 0});
+    topic.publish({4, 0.0f, 0});
+    topic.publish({5, 0.0f, 0});
+    TestMessage1 out[4];
+    ASSERT_EQ(topic.read_multiple(token, out, 2), 2u);
+    EXPECT_EQ(out[0].value1, 3);
+    EXPECT_EQ(out[1].value1, 4);
+    ASSERT_EQ(topic.read_multiple(token, out, 4), 1u);
+    EXPECT_EQ(out[0].value1, 5);
+}
+
+TEST(TopicTest, CacheLineLayoutIsCompileTimeSelectable) {
+#ifdef MREQ_CACHE_ALIGNED_LAYOUT
+    EXPECT_EQ(alignof(SubscriberSlot), mreq::internal::kCacheLineSize);
+    EXPECT_EQ(sizeof(SubscriberSlot) % mreq::internal::kCacheLineSize, 0u);
+#else
+    // Gömülü hedefler için kompakt yerleşim korunur
+    EXPECT_LE(sizeof(SubscriberSlot), 3 * sizeof(size_t));
+#endif
+}
+
+TEST(TopicTest, PerTopicSubscriberCapacity) {
+    // Kapasite 32'lik bitmap kelime sınırını aşar
+    mreq::Topic<TestMessage1, 2, 40> telemetry;
+    mreq::Topic<TestMessage1, 2, 1> single;
+    static_assert(SubscriberTable<TestMessage1, 40>::capacity() == 40);
+
+    Token tokens[40];
+    for (size_t i = 0; i < 40; ++i) {
+        auto token = telemetry.subscribe();
+        ASSERT_TRUE(token.has_value());
+        EXPECT_EQ(token.value(), i);
+        tokens[i] = token.value();
+    }
+    EXPECT_FALSE(telemetry.subscribe().has_value());
+
+    // Boşalan slot yeniden kullanılır; çift unsubscribe sayacı bozmaz
+    telemetry.unsubscribe(tokens[35]);
+    telemetry.unsubscribe(tokens[35]);
+    telemetry.publish({1, 0.0f, 0});
+    auto token = telemetry.subscribe();
+    ASSERT_TRUE(token.has_value());
+    EXPECT_EQ(token.value(), 35u);
+    EXPECT_FALSE(telemetry.check(35));
+    EXPECT_TRUE(telemetry.check(tokens[39]));
+
+    ASSERT_TRUE(single.subscribe().has_value());
+    EXPECT_FALSE(single.subscribe().has_value());
+}
+
+TEST(SubscriberTableTest, CountIsMaintained) {
+    SubscriberTable<TestMessage1, 3> table;
+    EXPECT_EQ(table.subscriber_count(), 0u);
+    auto a = table.subscribe().value();
+    auto b = table.subscribe().value();
+    EXPECT_EQ(table.subscriber_count(), 2u);
+    table.unsubscribe(a);
+    table.unsubscribe(a);
+    EXPECT_EQ(table.subscriber_count(), 1u);
+    EXPECT_EQ(table.subscribe().value(), a);
+    table.unsubscribe(b);
+    EXPECT_EQ(table.subscriber_count(), 1u);
+}
+
+TEST(TopicTest, DecimatedSubscription) {
+    mreq::Topic<TestMessage1, 16> topic;
+    auto every_third = topic.subscribe(mreq::SubscribeOptions::every(3)).value();
+    auto all = topic.subscribe().value();
+
+    topic.publish({1, 0.0f, 1});
+    topic.publish({2, 0.0f, 2});
+    EXPECT_FALSE(topic.check(every_third));
+    EXPECT_FALSE(topic.read(every_third).has_value());
+    EXPECT_TRUE(topic.check(all));
+
+    for (int i = 3; i <= 10; ++i) topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+
+    // Geride kalan abone atlanan mesajları kopyalamadan 3., 6., 9. mesajları okur
+    mreq::ReadInfo info;
+    auto msg = topic.read(every_third, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 3);
+    EXPECT_EQ(info.sequence, 3u);
+    EXPECT_EQ(info.dropped, 0u);
+
+    TestMessage1 out[8];
+    EXPECT_EQ(topic.read_multiple(every_third, out, 8), 2u);
+    EXPECT_EQ(out[0].value1, 6);
+    EXPECT_EQ(out[1].value1, 9);
+    EXPECT_FALSE(topic.check(every_third));
+
+    EXPECT_EQ(topic.read_multiple(all, out, 8), 8u);
+}
+
+TEST(TopicTest, DecimatedSubscriptionOverrun) {
+    mreq::Topic<TestMessage1, 4> topic;
+    auto every_second = topic.subscribe(mreq::SubscribeOptions::every(2)).value();
+
+    for (int i = 1; i <= 9; ++i) topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+
+    // Ring 6..9'u tutar: 2 ve 4 kayboldu, sıradaki hedef 6
+    mreq::ReadInfo info;
+    auto msg = topic.read(every_second, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 6);
+    EXPECT_EQ(info.dropped, 2u);
+
+    auto view = topic.read_spans(every_second, info);
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view.size(), 1u);
+    EXPECT_EQ(view.first().data->value1, 8);
+}
+
+TEST(TopicTest, DecimatedSubscriptionOverrunBeyondRing) {
+    mreq::Topic<TestMessage1, 4> topic;
+    auto every_tenth = topic.subscribe(mreq::SubscribeOptions::every(10)).value();
+
+    // Ring 22..25'i tutar: 10 ve 20 kayboldu, sıradaki hedef 30 henüz yayınlanmadı
+    for (int i = 1; i <= 25; ++i) topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+    EXPECT_FALSE(topic.read(every_tenth).has_value());
+    EXPECT_FALSE(topic.check(every_tenth));
+
+    // Kayıp hedef yayınlanınca teslim edilen mesajla bildirilir
+    for (int i = 26; i <= 30; ++i) topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+    mreq::ReadInfo info;
+    auto msg = topic.read(every_tenth, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 30);
+    EXPECT_EQ(info.dropped, 2u);
+
+    mreq::TopicStatsSnapshot snap{};
+    topic.stats(snap);
+    ASSERT_EQ(snap.subscriber_count, 1u);
+    EXPECT_EQ(snap.subscribers[0].lost, 2u);
+}
+
+TEST(TopicTest, ThrottledSubscriptionReadsLatest) {
+    mreq::Topic<TestMessage1, 8> topic;
+    auto throttled = topic.subscribe(mreq::SubscribeOptions::at_most_every(50'000'000)).value();
+
+    topic.publish({1, 0.0f, 1});
+    topic.publish({2, 0.0f, 2});
+    ASSERT_TRUE(topic.check(throttled));
+    auto msg = topic.read(throttled);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 2);
+
+    // Aralık dolmadan yeni mesaj verilmez
+    topic.publish({3, 0.0f, 3});
+    topic.publish({4, 0.0f, 4});
+    EXPECT_FALSE(topic.check(throttled));
+    EXPECT_FALSE(topic.read(throttled).has_value());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    ASSERT_TRUE(topic.check(throttled));
+    mreq::ReadInfo info;
+    msg = topic.read(throttled, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->value1, 4);
+    EXPECT_EQ(info.sequence, 4u);
+    EXPECT_EQ(info.dropped, 0u);
+    EXPECT_FALSE(topic.check(throttled));
+}
+
+namespace {
+bool is_even(const TestMessage1& msg) { return msg.value1 % 2 == 0; }
+}
+
+TEST(TopicTest, FilteredSubscription) {
+    mreq::Topic<TestMessage1, 8> topic;
+    auto even = topic.subscribe(mreq::SubscribeOptions::matching(mreq::where(&is_even))).value();
+
+    topic.publish({1, 0.0f, 1});
+    topic.publish({3, 0.0f, 2});
+    EXPECT_FALSE(topic.check(even));
+    EXPECT_FALSE(topic.read(even).has_value());
+
+    for (int i = 4; i <= 9; ++i) topic.publish({i, 0.0f, static_cast<uint64_t>(i)});
+    EXPECT_TRUE(topic.check(even));
+
+    // Eşleşmeyen mesajlar kopyalanmadan atlanır ve dropped'a sayılmaz
+    mreq::ReadInfo info;
+    TestMessage1 out[8];
+    ASSERT_EQ(topic.read_multiple(even, out, 8, info), 3u);
+    EXPECT_EQ(out[0].value1, 4);
+    EXPECT_EQ(out[1].value1, 6);
+    EXPECT_EQ(out[2].value1, 8);
+    EXPECT_EQ(info.sequence, 7u);
+    EXPECT_EQ(info.dropped, 0u);
+    EXPECT_FALSE(topic.check(even));
+
+    // Başka mesaj tipi için kurulan filtre reddedilir
+    mreq::Topic<TestMessage2, 4> other;
+    EXPECT_FALSE(other.subscribe(mreq::SubscribeOptions::matching(mreq::where(&is_even))).has_value());
+}
+
+TEST(TopicTest, FieldFilteredDecimatedSubscription) {
+    mreq::Topic<TestMessage1, 4> topic;
+    mreq::SubscribeOptions options = mreq::SubscribeOptions::every(2);
+    options.filter = mreq::field_equals<&TestMessage1::value1>(7);
+    auto sevens = topic.subscribe(options).value();
+
+    // Eşleşen 2. mesaj teslim edilir
+    topic.publish({7, 0.0f, 1});
+    topic.publish({1, 0.0f, 2});
+    EXPECT_FALSE(topic.check(sevens));
+    topic.publish({7, 0.0f, 3});
+    mreq::ReadInfo info;
+    auto msg = topic.read(sevens, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->timestamp, 3u);
+    EXPECT_EQ(info.sequence, 3u);
+
+    // Değerlendirilemeden ring'den düşen mesajlar dropped'a yazılır
+    for (int i = 4; i <= 9; ++i) topic.publish({i == 8 ? 1 : 7, 0.0f, static_cast<uint64_t>(i)});
+    msg = topic.read(sevens, info);
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->timestamp, 7u);
+    EXPECT_EQ(info.dropped, 2u);
+    // 8 eşleşmez, 9 sayacı ilerletir ama henüz teslim edilmez
+    EXPECT_FALSE(topic.check(sevens));
+    EXPECT_FALSE(topic.read(sevens).has_value());
+}
@@ -0,0 +1,172 @@
+#include "gtest/gtest.h"
+#include "mreq/mreq.hpp"
+#include "test_messages.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST(WaitSetTest, PollReportsOnlyReadyTopics) {
+    mreq::Topic<TestMessage1, 4> topic_a;
+    mreq::SeqlockTopic<TestMessage1, 4> topic_b;
+    mreq::MultiProducerTopic<TestMessage1, 4> topic_c;
+    auto token_a = topic_a.subscribe().value();
+    auto token_b = topic_b.subscribe().value();
+    auto token_c = topic_c.subscribe().value();
+
+    mreq::WaitSet ws;
+    auto a = ws.add(topic_a, token_a).value();
+    auto b = ws.add(topic_b, token_b).value();
+    auto c = ws.add(topic_c, token_c).value();
+
+    size_t ready[4];
+    EXPECT_EQ(ws.poll(ready, 4), 0u);
+
+    topic_b.publish({1, 0.0f, 1});
+    ASSERT_EQ(ws.poll(ready, 4), 1u);
+    EXPECT_EQ(ready[0], b);
+
+    // Okunmayan giriş tekrar raporlanır, okununca raporlanmaz
+    ASSERT_EQ(ws.poll(ready, 4), 1u);
+    EXPECT_EQ(ready[0], b);
+    topic_b.read(token_b);
+    EXPECT_EQ(ws.poll(ready, 4), 0u);
+
+    topic_a.publish({2, 0.0f, 2});
+    topic_c.publish({3, 0.0f, 3});
+    ASSERT_EQ(ws.poll(ready, 4), 2u);
+    EXPECT_EQ(ready[0], a);
+    EXPECT_EQ(ready[1], c);
+
+    // Kapasiteden fazla hazır giriş sonraki çağrıya kalır
+    topic_a.read(token_a);
+    topic_b.publish({4, 0.0f, 4});
+    ASSERT_EQ(ws.poll(ready, 1), 1u);
+    EXPECT_EQ(ready[0], b);
+    ASSERT_EQ(ws.poll(ready, 4), 2u);
+
+    ws.remove(a);
+    topic_a.publish({5, 0.0f, 5});
+    topic_b.read(token_b);
+    topic_c.read(token_c);
+    EXPECT_EQ(ws.poll(ready, 4), 0u);
+}
+
+TEST(WaitSetTest, AddThroughMetadata) {
+    const mreq::mreq_metadata* meta = MREQ_GET_METADATA(test_mp_topic);
+    auto token = meta->subscribe().value();
+
+    TestMessage1 msg{9, 0.0f, 9};
+    meta->publish(&msg);
+
+    mreq::WaitSet ws;
+    auto index = ws.add(meta, token).value();
+
+    // Eklemeden önce yayınlanan mesaj da raporlanır
+    size_t ready[2];
+    ASSERT_EQ(ws.poll(ready, 2), 1u);
+    EXPECT_EQ(ready[0], index);
+
+    meta->read<TestMessage1>(token);
+    EXPECT_EQ(ws.poll(ready, 2), 0u);
+    ws.remove(index);
+    meta->unsubscribe(token);
+
+    // Fonksiyon tablosu olmayan metadata eklenemez
+    EXPECT_FALSE(ws.add(MREQ_GET_METADATA(test_topic_1), 0).has_value());
+}
+
+TEST(WaitSetTest, WaitBlocksUntilPublish) {
+    mreq::Topic<TestMessage1, 4> topic;
+    auto token = topic.subscribe().value();
+
+    mreq::WaitSet ws;
+    auto index = ws.add(topic, token).value();
+
+    size_t ready[1];
+    EXPECT_EQ(ws.wait(ready, 1, 10), 0u);
+
+    std::thread publisher([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        topic.publish({1, 0.0f, 1});
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    const size_t count = ws.wait(ready, 1, 5000);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(4));
+    publisher.join();
+    ASSERT_EQ(count, 1u);
+    EXPECT_EQ(ready[0], index);
+}
+
+TEST(WaitSetTest, WaitHonorsTimeoutUnderEmptyWakeups) {
+    // Her publish uyandırır ama seyreltilmiş abonenin okunacak mesajı olmaz
+    mreq::Topic<TestMessage1, 4> topic;
+    auto token = topic.subscribe(mreq::SubscribeOptions::every(1000000)).value();
+
+    mreq::WaitSet ws;
+    ws.add(topic, token).value();
+
+    std::atomic<bool> done{false};
+    std::thread publisher([&] {
+        while (!done.load()) {
+            topic.publish({1, 0.0f, 1});
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    size_t ready[1];
+    const auto start = std::chrono::steady_clock::now();
+    const size_t count = ws.wait(ready, 1, 50);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    done = true;
+    publisher.join();
+
+    EXPECT_EQ(count, 0u);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(45));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+}
+
+TEST(WaitSetTest, DetachDoesNotWaitForLaterNotifies) {
+    // İlk listener her notify()'ı sırayla bırakılana kadar tutar
+    struct Gate {
+        std::atomic<int> entered{0};
+        std::atomic<bool> release[2] = {};
+    } gate;
+    const mreq::internal::TopicListener held{
+        [](void* context, size_t) {
+            Gate* g = static_cast<Gate*>(context);
+            const int n = g->entered.fetch_add(1);
+            while (!g->release[n].load()) std::this_thread::yield();
+        },
+        &gate, 0};
+    const mreq::internal::TopicListener victim{[](void*, size_t) {}, nullptr, 1};
+
+    mreq::internal::TopicListeners listeners;
+    ASSERT_TRUE(listeners.attach(&held));
+    ASSERT_TRUE(listeners.attach(&victim));
+
+    std::thread first([&] { listeners.notify(); });
+    while (gate.entered.load() < 1) std::this_thread::yield();
+
+    std::atomic<bool> detached{false};
+    std::thread detacher([&] {
+        listeners.detach(&victim);
+        detached = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));   // detach() epoch'u çevirsin
+
+    // detach()'tan sonra başlayan notify() sürerken detach() sadece ilkini bekler
+    std::thread second([&] { listeners.notify(); });
+    while (gate.entered.load() < 2) std::this_thread::yield();
+    EXPECT_FALSE(detached.load());
+    gate.release[0] = true;
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!detached.load() && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+    EXPECT_TRUE(detached.load());
+
+    gate.release[1] = true;
+    first.join();
+    second.join();
+    detacher.join();
+}